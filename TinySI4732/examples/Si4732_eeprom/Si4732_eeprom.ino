@@ -3,6 +3,9 @@
   patchの容量が大きいので、patch毎に書込みを行う。
   #include "init.h"によって、initパッチを書込みます。
   #include "full.h"によって、fullパッチを書込みます。
+  initパッチは0x0000、fullパッチは0x4000に書くので両方を書き込んでおける。
+  TinySI4732はヘッダのpatch_idを見て、EEPROM_PATCH_IDのパッチを読み込む。
+  ヘッダのpatch_crcにCRC32を書くので、TinySI4732はダウンロード時とpatchCheck()で壊れたパッチを見つけられる。
   
 */
 #include <Wire.h>
@@ -13,7 +16,8 @@ const byte EEADR = 0b1010000;
 #define HEADERSIZE  32
 union EepromHeader {
   struct{
-    byte reserved[8];  // Not used
+    uint32_t patch_crc; // CRC32 of patch data (0:not checked)
+    byte reserved[4];  // Not used
     byte status[8];    // Note used
     byte patch_id[14]; // Patch name
     word patch_size;  // Patch size (in bytes)
@@ -45,6 +49,19 @@ void headerInit(EepromHeader &eepromHeader, int romSize){
     eepromHeader.raw[i] = 0;
   strcpy((char *)&eepromHeader.refined.patch_id, patchId);
   eepromHeader.refined.patch_size = romSize;
+  eepromHeader.refined.patch_crc = crc32(romSize);
+  Serial.print("CRC32=");
+  Serial.println(eepromHeader.refined.patch_crc, HEX);
+}
+
+uint32_t crc32(word size){  // TinySI4732がダウンロード時に確認するCRC32
+  uint32_t crc = 0xFFFFFFFF;
+  for(word i = 0; i < size; ++i){
+    crc ^= pgm_read_byte(romData + i);
+    for(byte j = 0; j < 8; ++j)
+      crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320 : 0);
+  }
+  return ~crc;
 }
 void eepromWrite(word startAddr, word size, const EepromHeader &eepromHeader){
   byte data = 0;
@@ -97,8 +114,10 @@ bool eepromVerify(word startAddr, word size, const EepromHeader &eepromHeader){
   Wire.write(startAddr);
   Wire.endTransmission();
   for(byte i = 0; i < HEADERSIZE; ++i){
-    Wire.requestFrom(EEADR, (byte)1);
-    while(Wire.available() <= 0);
+    if(Wire.requestFrom(EEADR, (byte)1) != 1){  // 応答なしで止まらないようにする
+      verifyOk = false;
+      break;
+    }
     byte readData = Wire.read();
     if(readData != eepromHeader.raw[i])
       verifyOk = false;
@@ -114,9 +133,12 @@ bool eepromVerify(word startAddr, word size, const EepromHeader &eepromHeader){
     Wire.write(romAddr >> 8);
     Wire.write(romAddr);
     Wire.endTransmission();
-    Wire.requestFrom(EEADR, (byte)16);
+    if(Wire.requestFrom(EEADR, (byte)16) != 16){
+      Serial.println(" read error");
+      verifyOk = false;
+      break;
+    }
     for(word j = 0; j < 16; ++j){
-      while(Wire.available() <= 0);
       byte readData = Wire.read();
       if((i + j) < size)
         data = pgm_read_byte(romData + i + j);
@@ -12,11 +12,19 @@
   　ダウンロードするか選択すること。※デフォルトでは、Arduino FLASHからダウンロード。
     TinySi4732.hで、#include "patch.h"を記載するとFLASHからのダウンロードみとなる。
     記載なしだと外部EEPROMからのダウンロードとなる。
-    外部EEPROMからダウンロードする場合は、Si4732_eepromでinitパッチデータを書き込んでおくこと。
-    ※fullパッチは未対応。    
+    外部EEPROMからダウンロードする場合は、Si4732_eepromでinitパッチ(0x0000)またはfullパッチ(0x4000)を書き込んでおくこと。
+    どちらを読むかはTinySI4732.hのEEPROM_PATCH_IDで選ぶ。ヘッダのpatch_idで探し、なければもう一方を読む。
+    SSBへの切替時はパッチをpoll()で少しずつ送り、その間もLCDに進捗を表示してエンコーダ、SWを読む。
 
   ・ロータリーSWの仕様に応じて、rotaryEncoder()の判定値を変更すること。
 
+  ・TinySI4732.hでINT_PINを定義した場合は、SI4732のGPO2/INTをそのピンに接続すること。
+    RSSI, SNRは信号が変化した時だけ読み、シーク完了は割り込みですぐに検出する。
+
+  ・AMのANTCAP自動選択の結果を学習してeepromに保存する。学習済みの周波数は自動選択しないので
+  　チューンが速くなる。アンテナを替えた時は、バンド切替SWを押下しながら起動して学習をやり直すこと。
+  　SSBはssbAntCapを0にするとAMで学習した値を使う。
+
   ・初回起動時、バックアップ初期化時、bandTable[]変更時は、バンド切替SWを押下しながら起動させること。
 
 */
@@ -57,6 +65,7 @@ word updataEeprom;      // 2048*TICKTIME毎にeepromを更新
 const char *selectName[] = {"FREQ", "MODE", "FILTER", "ATT ", "VOLUME", "SEEK"};
 const byte funcSelectSize = sizeof(selectName) / sizeof(char *);
 tRsqStatus rsqStatus;   // RSSI, SNR
+tTuneStatus tuneStatus; // チューン結果
 
 struct tBandTable{
   char name[8];   // バンド名称
@@ -65,8 +74,8 @@ struct tBandTable{
 // struct tRadio{
 //   byte mode;        // 0:FM, 1:AM, 2:LSB, 3:USB
 //   word freq;        // 受信周波数 FM:6400~10800MHz, AM:149k~23000kHz, LSB/USB:520k~30000kHz
-//   word fmAmAntCap;  // FM:0(auto),1~191, AM:0(auto),1~6143
-//   word ssbAntCap;   // LSB/USB:1~6143
+//   word fmAmAntCap;  // FM:0(auto),1~191, AM:0(auto 学習値があれば使う),1~6143
+//   word ssbAntCap;   // LSB/USB:0(学習値 なければ2300kHz未満はauto, 以上は1),1~6143
 //   word minFreq;     // シーク下限周波数
 //   word maxFreq;     // シーク上限周波数
 //   byte stepFreq;    // 10:FM 100kHz, 1:AM 1kHz, 5:AM 5kHz, 9:AM 9kHz
@@ -76,7 +85,7 @@ struct tBandTable{
 //   byte fmAmFilter;  // FM:0:AUTO 1:110k, 2:84k 3:60k 4:40k
 //                     // AM:0:6.0k, 1:4.0k, 2:3.0k, 3:2.5kG, 4:2.0k, 5:1.8k, 6:1.0k
 //   byte ssbFilter;   // LSB/USB:0:4.0k, 1:3.0k, 2:2.2k, 3:1.2k, 4:1.0k, 5:0.5k
-//   int  bfoFreq;     // -16383kHz~16383kHz
+//   int  bfoFreq;     // -16383Hz~16383Hz
 // };
 tBandTable bandTable[] = {  // 上記のtRadioを参考に設定すること
   {"MW",   {AM,    729, 0, 0,   522,  1710,  9, false, true, 0, 0, 0, 0}},
@@ -84,9 +93,9 @@ tBandTable bandTable[] = {  // 上記のtRadioを参考に設定すること
 //  {"1.9M", {LSB,  1800, 0, 1,  1800,  1913,  1, false, true, 0, 0, 0, 0}},
 //  {"3.5M", {LSB,  3500, 0, 1,  3500,  3687,  1, false, true, 0, 0, 0, 0}},
 //  {"3.8M", {LSB,  3702, 0, 1,  3702,  3805,  1, false, true, 0, 0, 0, 0}},
-  {"7M",   {LSB,  7000, 0, 1,  7000,  7200,  1, false, true, 0, 0, 0, 0}},
-  {"10M",  {LSB, 10100, 0, 1, 10100, 10150,  1, false, true, 0, 0, 0, 0}},
-  {"14M",  {LSB, 14000, 0, 1, 14000, 14350,  1, false, true, 0, 0, 0, 0}},
+  {"7M",   {LSB,  7000, 0, 0,  7000,  7200,  1, false, true, 0, 0, 0, 0}},
+  {"10M",  {LSB, 10100, 0, 0, 10100, 10150,  1, false, true, 0, 0, 0, 0}},
+  {"14M",  {LSB, 14000, 0, 0, 14000, 14350,  1, false, true, 0, 0, 0, 0}},
 //  {"18M",  {LSB, 18000, 0, 1, 18000, 18168,  1, false, true, 0, 0, 0, 0}},
   {"49m",  {AM,   5730, 0, 1,  5730,  6295,  5, false, true, 0, 0, 0, 0}},
   {"31m",  {AM,   9250, 0, 1,  9250,  9900,  5, false, true, 0, 0, 0, 0}},
@@ -124,8 +133,10 @@ void setup() {
 }
 
 void loop() {
-  for( ; (word)millis() - startTime < 2000; ) // 初回2000ms,以後はTICKTIME毎に抜ける
+  for( ; (word)millis() - startTime < 2000; ){ // 初回2000ms,以後はTICKTIME毎に抜ける
     lcd.update(); // LCD表示更新
+    rx.poll();    // 非同期コマンドの処理
+  }
   startTime += TICKTIME;
   tRadio *p = &bandTable[band].radio;
   
@@ -133,9 +144,11 @@ void loop() {
   swRead();
 
   if(swa == SWON){ // バンド切替
+    if(rx.getPatchProgress() < 100)  // パッチのダウンロード中なら中止して次のバンドにする
+      rx.patchAbort();
     if(++band >= bandTableSize) band = 0;
     p = &bandTable[band].radio;
-    rx.setRadio(p);
+    rx.setRadioAsync(p);  // 設定中もLCD表示とエンコーダ読込みを継続する
     funcSelectTime = 0;
     funcSelect = 0;
   }
@@ -158,12 +171,12 @@ void loop() {
       byte gain;
       word filter;
       case 0:         // 周波数変更
-        rx.addFreq(p->mode <= AM? encoderCount * p->stepFreq : encoderCount * 100);
+        rx.addFreqAccel(encoderCount);  // 速く回すと10倍, 100倍のステップになる
         break;
       case 1:        // モード変更
         if(p->mode != FM)
           p->mode = constrain(p->mode + encoderCount, AM, USB);
-        rx.setRadio(p);
+        rx.setRadioAsync(p);
         break;
       case 2:         // フィルタ変更
         if(p->mode <= AM)
@@ -205,14 +218,30 @@ void loop() {
 }
 
 void display(){
+  bool update = rx.tuneDone(tuneStatus);  // チューン完了直後に更新
+#ifdef INT_PIN
+  if(rx.getIntFlags() & RSQINT)  // RSSIが変化した時に更新
+#else
   if(++updataTime == 1)  // 256*TICKTIME毎に更新
+#endif
+    update = true;
+  if(update && !rx.busy())  // 設定中は読まない
     rx.getRsqStatus(rsqStatus);
 
   lcd.clear();
   lcd.printf("%s %s %s\n", bandTable[band].name, rx.getLabel(L_FREQ), selectName[funcSelect]);
   lcd.printf("%-3s FL:%-5s ATT:%s\n", rx.getLabel(L_MODE), rx.getLabel(L_FILTER), rx.getLabel(L_AGC));  // FM, AM, LSB, USB
   lcd.printf("VOL:%s\n", rx.getLabel(L_VOLUME));
-  lcd.printf("RSSI:%d SNR:%d", rsqStatus.RSSI, rsqStatus.SNR);
+  byte progress = rx.getPatchProgress();  // パッチの進捗
+  if(progress < 100){
+    char bar[11];
+    memset(bar, '-', 10);
+    memset(bar, '#', progress / 10);
+    bar[10] = '\0';
+    lcd.printf("PATCH%3d%% %s", progress, bar);
+  }else{
+    lcd.printf("RSSI:%d SNR:%d", rsqStatus.RSSI, rsqStatus.SNR);
+  }
 }
 
 void rotaryEncoder(){
@@ -244,6 +273,11 @@ void writeEeprom(){
     EEPROM.put(addr, bandTable[i].radio);
     addr += sizeof(tRadio);
   }
+  byte size;
+  const tAntCap *antCap = rx.getAntCapTable(size);  // ANTCAPの学習値
+  EEPROM.update(addr++, size);
+  for(byte i = 0; i < size; ++i, addr += sizeof(tAntCap))
+    EEPROM.put(addr, antCap[i]);
   EEPROM.update(0x0000, CHECKDIGIT);
 }
 
@@ -259,4 +293,8 @@ void readEeeprom(){
     EEPROM.get(addr, bandTable[i].radio);
     addr += sizeof(tRadio);
   }
+  tAntCap antCap[ANTCAP_TABLE_SIZE];
+  byte size = EEPROM.read(addr++);  // setAntCapTableでANTCAP_TABLE_SIZE以下にする
+  EEPROM.get(addr, antCap);
+  rx.setAntCapTable(antCap, size);
 }
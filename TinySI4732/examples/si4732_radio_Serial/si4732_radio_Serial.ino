@@ -14,13 +14,14 @@
   　ダウンロードするか選択すること。※デフォルトでは、Arduino FLASHからダウンロード。
     TinySi4732.hで、#include "patch.h"を記載するとFLASHからのダウンロードとなる。記載なしだと
     外部EEPROMからのダウンロードとなる。
-    外部EEPROMからダウンロードする場合は、Si4732_eepromでinitパッチデータを書き込んでおくこと。
-    ※fullパッチは未対応。    
+    外部EEPROMからダウンロードする場合は、Si4732_eepromでinitパッチ(0x0000)またはfullパッチ(0x4000)を書き込んでおくこと。
+    どちらを読むかはTinySI4732.hのEEPROM_PATCH_IDで選ぶ。ヘッダのpatch_idで探し、なければもう一方を読む。
   ・初回起動時、バックアップ初期化時、bandTable[]変更時は、eコマンドを実行して再起動すること。
 
   ・command一覧
     f  n  現周波数に加算する。UNIT FM:0.01MHz, AM SSB:1kHz
-    F  n  周波数をnで指定する。UNIT FM:0.01MHz, AM:1kHz, SSB:1Hz
+    F  n  周波数をnで指定する。UNIT FM:0.01MHz, AM:1kHz, SSB:1kHz 完了を待ち、所要時間を表示する
+    H  n  周波数をHzで指定する。SSBは1kHz未満をBFOで合わせる
     a     自動周波数上昇
     A     自動周波数下降
     b  n  バンド切替 0 ～ バンド数 -1
@@ -30,6 +31,8 @@
     v  n  音量をnで指定する。0(min) ～ 63(max)
     s     seek up
     S     seek down
+    t     コマンドのトレースを表示して消去する。TinySI4732.hでTRACEを定義すること。
+    stats オペコード毎の統計を表示する。TinySI4732.hでSTATSを定義すること。
     e     eeprom reset。再起動後有効になる。
     w     現在の状態をArduino内蔵EEPROMに書込む
 
@@ -62,7 +65,7 @@ struct tBandTable{
 //   byte fmAmFilter;  // FM:0:AUTO 1:110k, 2:84k 3:60k 4:40k
 //                     // AM:0:6.0k, 1:4.0k, 2:3.0k, 3:2.5kG, 4:2.0k, 5:1.8k, 6:1.0k
 //   byte ssbFilter;   // LSB/USB:0:4.0k, 1:3.0k, 2:2.2k, 3:1.2k, 4:1.0k, 5:0.5k
-//   int  bfoFreq;     // -16383kHz~16383kHz
+//   int  bfoFreq;     // -16383Hz~16383Hz
 // };
 tBandTable bandTable[] = {  // 上記のtRadioを参考に設定すること
   {"MW",   {AM,    729, 0, 0,   522,  1710,  9, false, true, 0, 0, 0, 0}},
@@ -88,6 +91,8 @@ void setup() {
 
   readEeeprom();
   rx.setup();
+  if(!rx.patchCheck())  // SSBパッチを送らずにCRC32を確認(外部EEPROMは約230ms)
+    Serial.println("SSB patch CRC error!");
   rx.setRadio(&bandTable[band].radio);
   rx.setVolume(volume);
   rx.setMute(false);
@@ -107,7 +112,9 @@ void loop() {
 
   getLine(lineBuf);
   char *command = strtok(lineBuf, " ");
-  int parameter = atoi(strtok(nullptr, " "));
+  char *arg = strtok(nullptr, " ");
+  if(!arg) arg = (char *)"0";
+  int parameter = atoi(arg);
   xprintf("%s %d\n", command, parameter);
 
   tRadio *p = &bandTable[band].radio;
@@ -116,7 +123,12 @@ void loop() {
     rx.addFreq(parameter);
   
   }else if(!strcmp(command, "F")){  // 周波数設定
-    rx.setFreq(parameter);
+    tTuneStatus tuneStatus;
+    rx.tuneAndWait(parameter, tuneStatus);
+    xprintf("tune:%lums ANTCAP:%u\n", rx.getTuneTime() / 1000, tuneStatus.ANTCAP);
+
+  }else if(!strcmp(command, "H")){  // 周波数設定(Hz)
+    rx.setFreqHz(strtoul(arg, nullptr, 10));
 
   }else if(!strcmp(command, "a")){  // 自動周波数上昇
     while(true){
@@ -197,6 +209,28 @@ void loop() {
       xprintf("%sHz\n", rx.getLabel(L_FREQ));
     }
   
+#ifdef STATS
+  }else if(!strcmp(command, "stats")){  // 統計の表示 時間の単位はus
+    byte size;
+    const tStats *st = rx.getStats(size);
+    Serial.println("OP   count   write    read     total     max   ctsWait");
+    for(byte i = 0; i < size; ++i, ++st){
+      xprintf("%02X %7lu %7lu %7lu", st->opcode, st->count, st->writeBytes, st->readBytes);
+      xprintf(" %9lu %7lu %9lu\n", st->totalTime, st->maxTime, st->ctsWait);
+    }
+#endif
+#ifdef TRACE
+  }else if(!strcmp(command, "t")){  // トレースの表示 開始時刻(us) CTS待ち(us) STATUS 応答長: コマンド
+    for(byte i = 0; i < rx.getTraceSize(); ++i){
+      const tTrace *t = rx.getTrace(i);
+      xprintf("%10lu %6lu %02X %d:", t->startTime, t->ctsWait, t->status, t->resSize);
+      for(byte j = 0; j < t->cmdSize; ++j)
+        xprintf(" %02X", t->cmd[j]);
+      Serial.println();
+    }
+    rx.clearTrace();
+#endif
+
   }else if(!strcmp(command, "e")){  // eeprom reset
     EEPROM.update(0x0000, 0);
     Serial.println("please restart!");
@@ -218,6 +252,7 @@ void loop() {
 void getLine(char *lineBuf){  // シリアル文字列の入力
   byte p = 0;
   do{
+    rx.poll();  // 入力待ちの間に保留中のチューンを出力する
     while(Serial.available() > 0){
       char ch = Serial.read();
       if(ch == '\r' || ch == '\n') ch = '\0';
@@ -0,0 +1,38 @@
+#pragma once
+/*
+  ホスト(Linux)でTinySI4732をビルドするための最小限のArduino互換ヘッダ
+  ARDUINOは定義しないので、TinySI4732はMockBusを使う。
+  時間関数とピン関数の実体はモックまたはシミュレータで用意する。
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const byte *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define highByte(w) ((byte)((w) >> 8))
+#define lowByte(w)  ((byte)((w) & 0xFF))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define LOW     0
+#define HIGH    1
+#define INPUT   0
+#define OUTPUT  1
+#define INPUT_PULLUP 2
+#define FALLING 2
+#define digitalPinToInterrupt(pin) (pin)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(byte pin, byte mode);
+void digitalWrite(byte pin, byte val);
+int digitalRead(byte pin);
+void attachInterrupt(byte interrupt, void (*isr)(), int mode);
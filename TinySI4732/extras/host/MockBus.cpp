@@ -0,0 +1,40 @@
+/*
+  ホスト(Linux)用の簡易モック
+  全ての読込みにCTS=1のSTATUSと0の応答を返し、書込み・読込みのバイト数を数える。
+  時間は仮想時間で、delay()は待たずに時計を進める。
+
+  ビルド例(TinySI4732/extras/hostで実行)
+    g++ -std=gnu++11 -I. -I../../src ../../src/TinySI4732.cpp MockBus.cpp mock_main.cpp -o mock
+*/
+#include <Arduino.h>
+#include "TinySI4732Bus.h"
+
+static unsigned long nowMicros;     // 仮想時間(us)
+unsigned long mockWriteBytes;       // 書込みバイト数
+unsigned long mockReadBytes;        // 読込みバイト数
+
+unsigned long millis() { return nowMicros / 1000; }
+unsigned long micros() { return nowMicros += 1; }  // 呼出し毎に1us進める
+void delay(unsigned long ms) { nowMicros += ms * 1000; }
+void delayMicroseconds(unsigned int us) { nowMicros += us; }
+void pinMode(byte, byte) {}
+void digitalWrite(byte, byte) {}
+int digitalRead(byte) { return HIGH; }
+void attachInterrupt(byte, void (*)(), int) {}
+
+void MockBus::begin(unsigned long) {}
+
+byte MockBus::write(byte, const byte *, byte size) {
+  mockWriteBytes += size;
+  return 0;
+}
+
+void MockBus::clear() {}
+
+byte MockBus::read(byte, byte *buf, byte size) {
+  mockReadBytes += size;
+  memset(buf, 0, size);
+  if (size)
+    buf[0] = 0x80;  // CTS
+  return size;
+}
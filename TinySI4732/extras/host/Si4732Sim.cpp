@@ -0,0 +1,461 @@
+/*
+  SI4732の動作シミュレータ(ホスト用)
+  POWER_UP, TUNE, SEEK, RSQ, AGC, プロパティ, パッチの各コマンドと
+  CTS, STCのタイミングをモデル化し、I2Cのバス時間を指定クロックで積算する。
+  GPO2/INTはattachInterrupt()の関数を仮想時間でSTC, RSQ割り込みの発生時に呼ぶ。
+  外部EEPROM(0x50 24C256)はアドレスの設定と連続読込みだけをモデル化する(書込み時間なし)。
+  局の配置、RSSI, SNR, ANTCAPは簡単なモデル値。ANTCAPを指定した時は自動選択値とのずれでRSSIが下がる。
+*/
+#include <Arduino.h>
+#include "TinySI4732Bus.h"
+#include "Si4732Sim.h"
+
+tSimStats simStats;
+tSimTiming simTiming = {
+  70000,  // powerUp
+  80,     // command
+  120,    // property
+  180,    // patchRecord
+  300,    // patchArgs
+  60000,  // tuneFm
+  80000,  // tuneAm
+  40000,  // tuneAmCap
+  40000,  // tuneSsb
+  40000,  // seekFm
+  60000,  // seekAm
+};
+
+static uint64_t nowNs;              // 仮想時間(ns)
+static unsigned long busClock = 100000;
+static bool clockFixed;
+static uint8_t resetPin = 0xFF;
+static const uint64_t CPU_NS = 2000;  // micros(), millis()の呼出し時間
+static const byte CHIP_ADDR = 0x11;   // SENピン LOW
+static const byte EEPROM_ADDR = 0x50; // 外部EEPROM
+static byte eeprom[0x8000];           // 24C256
+static word eepromAddr;               // 次に読み書きするアドレス
+static byte patch[0x4000];            // 受信したパッチ(fullパッチ15832byteまで)
+static word patchSize;
+static unsigned long faultCount;      // 失敗させる残りトランザクション数
+static unsigned long faultStall;      // 失敗1回の停止時間(us)
+static unsigned long eepromFault;     // 外部EEPROMの読込みを途中で失敗させるまでの回数 0:なし
+static void (*intIsr)();              // GPO2/INTの割り込み処理
+
+static const word fmStations[] = { 7650, 8010, 8250, 8470, 9000, 9540, 10140 };  // 10kHz
+static const word amStations[] = { 594, 666, 729, 828, 954, 1134, 1242, 1422,
+                                   5960, 6055, 9500, 9750, 11780, 15140 };         // kHz
+
+struct tChip{
+  bool powered;
+  bool patchMode;       // パッチ受信中
+  bool patched;         // SSBパッチ適用済み
+  byte func;            // 0:FM, 1:AM
+  byte ssbMode;         // 0:AM, 1:LSB, 2:USB
+  uint64_t busyUntil;   // CTS=0の期間(ns)
+  bool err;
+  word freq;
+  word antCap;
+  bool autoCap;
+  bool stcPending;
+  uint64_t stcAt;       // STCINTが立つ時刻(ns)
+  bool stcSignaled;     // STCの割り込み通知済み
+  bool rsqInt;          // RSQINT
+  bool latch;           // 次のCTS=1の読込みで割り込み要因をSTATUSに取込む
+  byte intBits;         // STATUSのbit6:0に見える割り込み要因
+  bool gpo2;            // GPO2/INT出力有効
+  bool seeking;
+  word seekFrom;
+  int seekDir;
+  word seekSteps;       // 目標までのチャンネル数
+  bool seekFail;
+  uint64_t seekBegin;
+  uint64_t seekDwell;
+  byte agcDisable;
+  byte agcIndex;
+  word props[64][2];
+  byte propCount;
+  byte resp[16];
+  byte respLen;
+};
+static tChip chip;
+
+void simSetClock(unsigned long hz) { busClock = hz; clockFixed = true; }
+unsigned long simGetClock() { return busClock; }
+uint64_t simNowNs() { return nowNs; }
+void simResetStats() { memset(&simStats, 0, sizeof(simStats)); }
+void simSetResetPin(uint8_t pin) { resetPin = pin; }
+void simInjectFault(unsigned long count, unsigned long stallUs) { faultCount = count; faultStall = stallUs; }
+void simInjectEepromFault(unsigned long after) { eepromFault = after; }
+
+void simLoadEeprom(word addr, const byte *data, word size) {
+  for (word i = 0; i < size; ++i)
+    eeprom[(addr + i) & 0x7FFF] = data[i];
+}
+
+const byte *simPatchData(word &size) {
+  size = patchSize;
+  return patch;
+}
+
+static bool fault() {  // 故障注入
+  if (!faultCount)
+    return false;
+  --faultCount;
+  ++simStats.faults;
+  nowNs += (uint64_t)faultStall * 1000;
+  return true;
+}
+
+static void updateInt();
+unsigned long millis() { nowNs += CPU_NS; updateInt(); return nowNs / 1000000; }
+unsigned long micros() { nowNs += CPU_NS; updateInt(); return nowNs / 1000; }
+void delay(unsigned long ms) { nowNs += (uint64_t)ms * 1000000; updateInt(); }
+void delayMicroseconds(unsigned int us) { nowNs += (uint64_t)us * 1000; updateInt(); }
+void pinMode(byte, byte) {}
+void attachInterrupt(byte, void (*isr)(), int) { intIsr = isr; }
+int digitalRead(byte) { return HIGH; }
+void digitalWrite(byte pin, byte val) {
+  if (pin == resetPin && val == LOW)
+    memset(&chip, 0, sizeof(chip));  // リセット
+}
+
+static void busTime(byte size) {  // START + アドレス + データ + STOP
+  uint64_t ns = (uint64_t)(9 * (size + 1) + 2) * 1000000000 / busClock;
+  nowNs += ns;
+  simStats.busNs += ns;
+  ++simStats.transactions;
+}
+
+static word getProp(word prop, word def) {
+  for (byte i = 0; i < chip.propCount; ++i)
+    if (chip.props[i][0] == prop)
+      return chip.props[i][1];
+  return def;
+}
+
+static void setProp(word prop, word value) {
+  for (byte i = 0; i < chip.propCount; ++i)
+    if (chip.props[i][0] == prop) {
+      chip.props[i][1] = value;
+      return;
+    }
+  if (chip.propCount < 64) {
+    chip.props[chip.propCount][0] = prop;
+    chip.props[chip.propCount++][1] = value;
+  }
+}
+
+static bool isFm() { return chip.func == 0; }
+
+static byte rssiAt(word freq) {  // 最寄りの局からの距離でRSSIを決める
+  const word *st = isFm() ? fmStations : amStations;
+  byte n = isFm() ? sizeof(fmStations) / sizeof(word) : sizeof(amStations) / sizeof(word);
+  int width = isFm() ? 10 : 5;
+  int best = 8;
+  for (byte i = 0; i < n; ++i) {
+    int d = abs((int)freq - (int)st[i]);
+    if (d < width * 2) {  // 隣接チャンネルでは受信不可の強さ
+      int r = 45 - d * 30 / width;
+      if (r > best) best = r;
+    }
+  }
+  return best;
+}
+
+static byte snrAt(word freq) { int r = rssiAt(freq) - 12; return r < 0 ? 0 : r; }
+
+static word autoCapAt(word freq) {  // AMのANTCAP自動選択値
+  if (isFm()) return 0;
+  double c = 4000.0 * (1000.0 / freq) * (1000.0 / freq);
+  return c > 6143 ? 6143 : c < 1 ? 1 : (word)c;
+}
+
+static byte tunedRssi() {  // ANTCAPのずれ2%毎に1dB下がる
+  byte r = rssiAt(chip.freq);
+  if (isFm() || chip.autoCap) return r;
+  word best = autoCapAt(chip.freq);
+  long loss = labs((long)chip.antCap - best) * 50 / best;
+  return loss >= r ? 0 : r - loss;
+}
+
+static word bandBottom() { return getProp(isFm() ? 0x1400 : 0x3400, isFm() ? 8750 : 520); }
+static word bandTop() { return getProp(isFm() ? 0x1401 : 0x3401, isFm() ? 10790 : 1710); }
+static word spacing() { return getProp(isFm() ? 0x1402 : 0x3402, 10); }
+
+static word seekStep(word freq, int dir) {  // 1チャンネル移動(WRAPあり)
+  long f = (long)freq + dir * spacing();
+  if (f > bandTop()) f = bandBottom();
+  if (f < bandBottom()) f = bandTop();
+  return f;
+}
+
+static void updateSeek() {  // シーク中の周波数を時間から求める
+  if (!chip.seeking) return;
+  word steps = (nowNs - chip.seekBegin) / chip.seekDwell;
+  if (steps >= chip.seekSteps) {
+    steps = chip.seekSteps;
+    chip.seeking = false;
+  }
+  word f = chip.seekFrom;
+  for (word i = 0; i < steps; ++i)
+    f = seekStep(f, chip.seekDir);
+  chip.freq = f;
+}
+
+static byte status() {
+  updateSeek();
+  byte st = 0;
+  if (nowNs >= chip.busyUntil) st |= 0x80;
+  if (chip.err) st |= 0x40;
+  if (st & 0x80 && chip.latch) {  // 割り込み要因はコマンド(GET_INT_STATUS等)の応答でだけ更新される
+    chip.latch = false;
+    chip.intBits = 0;
+    if (chip.rsqInt) chip.intBits |= 0x08;
+    if (chip.stcPending && nowNs >= chip.stcAt) chip.intBits |= 0x01;
+  }
+  return st | chip.intBits;
+}
+
+static void updateInt() {  // 割り込み要因の更新 許可された要因が立ったらINTピンを落とす
+  if (!chip.powered || chip.patchMode)
+    return;
+  byte ien = getProp(0x0001, 0);  // GPO_IEN
+  bool fire = false;
+  bool tuned = !chip.stcPending || nowNs >= chip.stcAt;
+  if (chip.stcPending && tuned && !chip.stcSignaled) {
+    chip.stcSignaled = true;
+    fire |= ien & 0x01;
+  }
+  if (!chip.rsqInt && tuned) {  // RSSIの上下限(チューン中は測らない)
+    word base = isFm() ? 0x1200 : chip.ssbMode ? 0x3300 : 0x3200;
+    word source = getProp(base, 0);
+    byte r = rssiAt(chip.freq);
+    if (((source & 0x01) && r < getProp(base + 4, 0)) || ((source & 0x02) && r > getProp(base + 3, 127))) {
+      chip.rsqInt = true;
+      fire |= ien & 0x08;
+    }
+  }
+  if (fire && chip.gpo2 && intIsr) {
+    ++simStats.interrupts;
+    intIsr();
+  }
+}
+
+static void busy(unsigned long us) { chip.busyUntil = nowNs + (uint64_t)us * 1000; }
+
+static void startTune(word freq, word cap, unsigned long us) {
+  chip.seeking = false;
+  chip.freq = freq;
+  chip.autoCap = cap == 0;
+  chip.antCap = cap ? cap : autoCapAt(freq);
+  chip.stcPending = true;
+  chip.stcSignaled = false;
+  chip.stcAt = nowNs + (uint64_t)us * 1000;
+}
+
+static void startSeek(byte arg) {
+  chip.seekDir = arg & 0x08 ? 1 : -1;
+  chip.seekFrom = chip.freq;
+  chip.seekSteps = 0;
+  chip.seekFail = true;
+  word f = chip.freq;
+  do {  // 次の局を探す。一周したら失敗
+    f = seekStep(f, chip.seekDir);
+    ++chip.seekSteps;
+    if (rssiAt(f) >= 25) {
+      chip.seekFail = false;
+      break;
+    }
+  } while (f != chip.seekFrom);
+  chip.seeking = true;
+  chip.seekBegin = nowNs;
+  chip.seekDwell = (uint64_t)(isFm() ? simTiming.seekFm : simTiming.seekAm) * 1000;
+  chip.stcPending = true;
+  chip.stcSignaled = false;
+  chip.stcAt = nowNs + chip.seekSteps * chip.seekDwell;
+}
+
+static void response(const byte *data, byte size) {
+  memcpy(&chip.resp[1], data, size);
+  chip.respLen = size + 1;
+}
+
+static void command(const byte *cmd, byte size) {
+  if (nowNs < chip.busyUntil) {  // CTS=0で送られたコマンドは無視される
+    ++simStats.ctsViolations;
+    return;
+  }
+  ++simStats.commands;
+  chip.err = false;
+  chip.latch = true;
+  chip.respLen = 1;
+  if (!chip.powered && cmd[0] != 0x01) {
+    chip.err = true;
+    return;
+  }
+  if (chip.patchMode) {  // パッチ受信中
+    if (cmd[0] == 0x15 || cmd[0] == 0x16) {
+      ++simStats.patchRecords;
+      if (size == 8 && patchSize <= sizeof(patch) - 8) {
+        memcpy(&patch[patchSize], cmd, 8);
+        patchSize += 8;
+      }
+      busy(cmd[0] == 0x15 ? simTiming.patchArgs : simTiming.patchRecord);
+      return;
+    }
+    chip.patchMode = false;  // パッチ終了、パッチ付きで起動
+    chip.patched = true;
+  }
+  switch (cmd[0]) {
+    case 0x01:  // POWER_UP
+      memset(&chip, 0, sizeof(chip));
+      chip.powered = true;
+      chip.func = cmd[1] & 0x0F;
+      chip.patchMode = cmd[1] & 0x20;
+      if (chip.patchMode)
+        patchSize = 0;
+      chip.gpo2 = cmd[1] & 0x40;
+      chip.freq = isFm() ? 8750 : 520;
+      busy(simTiming.powerUp);
+      return;
+    case 0x10: {  // GET_REV
+      const byte rev[] = { 32, '6', '0', (byte)(chip.patched ? 0xD0 : 0), (byte)(chip.patched ? 0x01 : 0), '2', '0', 'A' };
+      response(rev, sizeof(rev));
+      break;
+    }
+    case 0x11:  // POWER_DOWN
+      chip.powered = false;
+      chip.patched = false;
+      break;
+    case 0x12:  // SET_PROPERTY
+      setProp((cmd[2] << 8) | cmd[3], (cmd[4] << 8) | cmd[5]);
+      busy(simTiming.property);
+      return;
+    case 0x13: {  // GET_PROPERTY
+      word v = getProp((cmd[2] << 8) | cmd[3], 0);
+      const byte res[] = { 0, highByte(v), lowByte(v) };
+      response(res, sizeof(res));
+      break;
+    }
+    case 0x14:  // GET_INT_STATUS 割り込み要因はstatus()で取込む
+      break;
+    case 0x20:  // FM_TUNE_FREQ
+    case 0x40: {  // AM_TUNE_FREQ, SSB_TUNE_FREQ
+      word freq = (cmd[2] << 8) | cmd[3];
+      if (cmd[0] == 0x20) {
+        startTune(freq, cmd[4], simTiming.tuneFm);
+      } else {
+        word cap = (cmd[4] << 8) | cmd[5];
+        chip.ssbMode = chip.patched ? cmd[1] >> 6 : 0;
+        startTune(freq, cap, chip.ssbMode ? simTiming.tuneSsb : cap ? simTiming.tuneAmCap : simTiming.tuneAm);
+      }
+      break;
+    }
+    case 0x21:  // FM_SEEK_START
+    case 0x41:  // AM_SEEK_START
+      startSeek(cmd[1]);
+      break;
+    case 0x22:  // FM_TUNE_STATUS
+    case 0x42: {  // AM_TUNE_STATUS
+      updateSeek();
+      if (size > 1 && (cmd[1] & 0x02) && chip.seeking) {  // CANCEL
+        chip.seeking = false;
+        chip.stcAt = nowNs;
+      }
+      bool stc = chip.stcPending && nowNs >= chip.stcAt;
+      byte capH = isFm() ? 0 : highByte(chip.antCap);
+      byte capL = isFm() ? chip.antCap : lowByte(chip.antCap);
+      const byte res[] = { (byte)((chip.seekFail && stc ? 0x80 : 0) | (rssiAt(chip.freq) >= 25)),
+                           highByte(chip.freq), lowByte(chip.freq), tunedRssi(), snrAt(chip.freq), capH, capL };
+      response(res, sizeof(res));
+      if (size > 1 && (cmd[1] & 0x01) && stc)  // INTACK
+        chip.stcPending = false;
+      break;
+    }
+    case 0x23:  // FM_RSQ_STATUS
+    case 0x43: {  // AM_RSQ_STATUS
+      updateSeek();
+      const byte res[] = { 0, (byte)(rssiAt(chip.freq) >= 25), 0, tunedRssi(), snrAt(chip.freq), 0, 0 };
+      response(res, sizeof(res));
+      if (size > 1 && (cmd[1] & 0x01))  // INTACK
+        chip.rsqInt = false;
+      break;
+    }
+    case 0x24: {  // FM_RDS_STATUS RDSはモデル化しない(FIFOは常に空)
+      const byte res[12] = { 0 };
+      response(res, sizeof(res));
+      break;
+    }
+    case 0x27:  // FM_AGC_STATUS
+    case 0x47: {  // AM_AGC_STATUS
+      const byte res[] = { chip.agcDisable, chip.agcIndex };
+      response(res, sizeof(res));
+      break;
+    }
+    case 0x28:  // FM_AGC_OVERRIDE
+    case 0x48:  // AM_AGC_OVERRIDE
+      chip.agcDisable = cmd[1];
+      chip.agcIndex = size > 2 ? cmd[2] : 0;
+      break;
+    default:
+      chip.err = true;
+      break;
+  }
+  busy(simTiming.command);
+}
+
+void MockBus::begin(unsigned long clock) {
+  if (!clockFixed)
+    busClock = clock;
+}
+
+byte MockBus::write(byte addr, const byte *buf, byte size) {
+  busTime(size);
+  if (fault())
+    return 5;  // タイムアウト
+  if (addr == EEPROM_ADDR) {  // 先頭2バイトはアドレス、続きはページ書込み
+    simStats.writeBytes += size;
+    if (size >= 2)
+      eepromAddr = ((buf[0] << 8) | buf[1]) & 0x7FFF;
+    for (byte i = 2; i < size; ++i, eepromAddr = (eepromAddr + 1) & 0x7FFF)
+      eeprom[eepromAddr] = buf[i];
+    return 0;
+  }
+  if (addr != CHIP_ADDR)
+    return 2;  // アドレスNACK
+  simStats.writeBytes += size;
+  if (size)
+    command(buf, size);
+  return 0;
+}
+
+void MockBus::clear() {
+  busTime(0);  // 9クロック + STOP 相当
+  ++simStats.busClears;
+}
+
+byte MockBus::read(byte addr, byte *buf, byte size) {
+  busTime(size);
+  if (fault())
+    return 0;
+  if (addr == EEPROM_ADDR) {  // 連続読込み
+    byte n = size;
+    if (eepromFault && !--eepromFault) {  // 半分読んだところで切れた。アドレスカウンタは進んでいる
+      ++simStats.faults;
+      n = size / 2;
+    }
+    simStats.readBytes += n;
+    for (byte i = 0; i < n; ++i, eepromAddr = (eepromAddr + 1) & 0x7FFF)
+      buf[i] = eeprom[eepromAddr];
+    return n;
+  }
+  if (addr != CHIP_ADDR)
+    return 0;
+  simStats.readBytes += size;
+  if (!size)
+    return 0;
+  buf[0] = status();
+  for (byte i = 1; i < size; ++i)
+    buf[i] = (buf[0] & 0x80) && i < chip.respLen ? chip.resp[i] : 0;
+  return size;
+}
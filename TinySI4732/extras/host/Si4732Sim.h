@@ -0,0 +1,48 @@
+#pragma once
+/*
+  SI4732の動作シミュレータ(ホスト用)
+  MockBusと時間関数を実装し、TinySI4732.cppをそのままLinuxで動かす。
+  時間は仮想時間で、I2Cの転送時間とdelay()、チップの処理時間(CTS, STC)で進む。
+*/
+#include <stdint.h>
+
+struct tSimStats{
+  uint64_t busNs;             // I2Cバスの占有時間(ns)
+  unsigned long transactions; // トランザクション数
+  unsigned long writeBytes;   // 書込みバイト数(アドレスを除く)
+  unsigned long readBytes;    // 読込みバイト数(アドレスを除く)
+  unsigned long commands;     // 受理したコマンド数
+  unsigned long ctsViolations;  // CTS=0の時に送られたコマンド数
+  unsigned long patchRecords;   // 受理したパッチレコード数
+  unsigned long faults;         // 故障注入で失敗させたトランザクション数
+  unsigned long busClears;      // バスクリアの回数
+  unsigned long interrupts;     // INTピンの割り込み回数
+};
+
+struct tSimTiming{            // チップの処理時間(us) モデル値
+  unsigned long powerUp;      // POWER_UP
+  unsigned long command;      // 一般コマンドのtCTS
+  unsigned long property;     // SET_PROPERTY
+  unsigned long patchRecord;  // PATCH_DATA 1レコード
+  unsigned long patchArgs;    // PATCH_ARGS 1レコード(ブロックの先頭)
+  unsigned long tuneFm;       // FM TUNE → STC
+  unsigned long tuneAm;       // AM TUNE → STC (ANTCAP自動)
+  unsigned long tuneAmCap;    // AM TUNE → STC (ANTCAP指定)
+  unsigned long tuneSsb;      // SSB TUNE → STC
+  unsigned long seekFm;       // FMシーク 1チャンネル
+  unsigned long seekAm;       // AMシーク 1チャンネル
+};
+
+extern tSimStats simStats;
+extern tSimTiming simTiming;
+
+void simSetClock(unsigned long hz);   // I2Cクロックを固定する(setup()の指定より優先)
+unsigned long simGetClock();
+uint64_t simNowNs();                  // 仮想時間(ns)
+void simResetStats();
+void simSetResetPin(uint8_t pin);     // リセットピン番号(LOWでチップをリセット)
+void simInjectFault(unsigned long count, unsigned long stallUs);  // 次のcount回のトランザクションを失敗させる
+                                      // stallUs:1回の停止時間(トランスポートのタイムアウト相当)
+void simInjectEepromFault(unsigned long after);  // after回目の外部EEPROMの読込みを半分で失敗させる
+void simLoadEeprom(uint16_t addr, const uint8_t *data, uint16_t size);  // 外部EEPROMの内容を設定する
+const uint8_t *simPatchData(uint16_t &size);  // 最後のPATCH付きPOWER_UPから受信したパッチレコード(8バイト単位)
@@ -0,0 +1,377 @@
+/*
+  シミュレータ上でTinySI4732の各APIを計測する
+  仮想時間、I2Cバス時間、転送バイト数、CTS違反数を表示する。
+
+  ビルド例(TinySI4732/extras/hostで実行)
+    g++ -std=gnu++11 -O2 -I. -I../../src ../../src/TinySI4732.cpp Si4732Sim.cpp bench.cpp -o bench
+    ./bench [I2Cクロック(Hz)]
+  -DSTATSを付けるとオペコード毎の統計も表示する。
+  -DINT_PIN=0を付けるとGPO2/INT割り込みで完了を検出する。
+  -DEXTEEPROMPATCHを付けるとパッチを外部EEPROM(Si4732_eepromのinit.h, full.hの内容)から読み込む。
+*/
+#include <Arduino.h>
+#include "TinySI4732.h"
+#include "Si4732Sim.h"
+
+#define RESET_PIN 10
+
+static TinySI4732 rx(RESET_PIN);
+static tSimStats last;
+static uint64_t lastNs;
+
+namespace patchInit {  // パッチの内容の照合にも使う
+#include "../../examples/Si4732_eeprom/init.h"
+static const word addr = START_ADDR;
+}
+#undef TITLE
+#undef START_ADDR
+namespace patchFull {
+#include "../../examples/Si4732_eeprom/full.h"
+static const word addr = START_ADDR;
+}
+
+#ifndef FLASHROMPATCH
+static uint32_t crc32(const byte *data, word size) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (size--) {
+    crc ^= *data++;
+    for (byte i = 0; i < 8; ++i)
+      crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320 : 0);
+  }
+  return ~crc;
+}
+
+static void loadEeprom(word addr, const char *patchId, const byte *romData, word size) {  // Si4732_eepromと同じ形式 32バイトのヘッダとパッチ
+  byte header[32] = { 0 };
+  uint32_t crc = crc32(romData, size);
+  for (byte i = 0; i < 4; ++i)
+    header[i] = crc >> (i * 8);  // patch_crc
+  strcpy((char *)&header[16], patchId);
+  header[30] = lowByte(size);
+  header[31] = highByte(size);
+  simLoadEeprom(addr, header, sizeof(header));
+  simLoadEeprom(addr + sizeof(header), romData, size);
+}
+#endif
+
+static void patchVerify() {  // シミュレータが受信したパッチをinit.h, full.hと照合する
+  word size;
+  const byte *patch = simPatchData(size);
+  const char *name = "NG";
+  if (size == sizeof(patchInit::romData) && !memcmp(patch, patchInit::romData, size))
+    name = "init";
+  else if (size == sizeof(patchFull::romData) && !memcmp(patch, patchFull::romData, size))
+    name = "full";
+  printf("  patch records:%u verify:%s\n", size / 8, name);
+}
+
+static void begin() {
+  last = simStats;
+  lastNs = simNowNs();
+}
+
+static void report(const char *name) {
+  printf("%-22s %10.3f %10.1f %7lu %7lu %6lu %4lu\n", name,
+         (simNowNs() - lastNs) / 1e6,
+         (simStats.busNs - last.busNs) / 1e3,
+         simStats.writeBytes - last.writeBytes,
+         simStats.readBytes - last.readBytes,
+         simStats.transactions - last.transactions,
+         simStats.ctsViolations - last.ctsViolations);
+}
+
+static void spin(int step, int count, const char *name) {  // エンコーダを速く回す(2ms毎にaddFreq)
+  begin();
+  for (int i = 0; i < count; ++i) {
+    rx.addFreq(step);
+    unsigned long t = millis();
+    while (millis() - t < 2)
+      rx.poll();
+  }
+  for (unsigned long t = millis(); millis() - t < TUNE_INTERVAL; )  // 最後のチューンを待つ
+    rx.poll();
+  while (rx.poll());
+  report(name);
+  printf("  commands:%lu freq:%s\n", simStats.commands - last.commands, rx.getLabel(L_FREQ));
+}
+
+static void sweep(tRadio *r, bool accel, const char *name) {  // 10ms毎のクリックでバンドの下限から上限まで動かす
+  rx.setFreqHz(r->minFreq * 1000UL);
+  delay(TUNE_INTERVAL);
+  begin();
+  unsigned long count = 0;
+  while (rx.getFreqHz() < r->maxFreq * 1000UL) {
+    if (accel)
+      rx.addFreqAccel(1);
+    else
+      rx.addFreq(SSB_STEP);
+    ++count;
+    for (unsigned long t = millis(); millis() - t < 10; )
+      rx.poll();
+  }
+  while (rx.poll());
+  report(name);
+  printf("  detents:%lu\n", count);
+}
+
+static unsigned long stcErrors;  // STC_TIMEOUTになったチューンの数
+
+static void stcCheck() {  // チューンがSI4732_ERR_STCで終わっていないか
+  if (rx.getError() == SI4732_ERR_STC)
+    ++stcErrors;
+}
+
+static void tuneWait(word freq, const char *name) {  // チューン完了までの時間
+  tTuneStatus status;
+  begin();
+  rx.tuneAndWait(freq, status);
+  stcCheck();
+  report(name);
+  printf("  tune:%lu us freq:%u RSSI:%u SNR:%u ANTCAP:%u\n", rx.getTuneTime(), status.FREQ,
+         status.RSSI, status.SNR, status.ANTCAP);
+}
+
+static void capScan(word from, word to, word step, const char *name) {  // 同じ範囲を2回チューンする。2回目は学習値を使う
+  for (int pass = 1; pass <= 2; ++pass) {
+    tTuneStatus status;
+    unsigned long tuneUs = 0, rssi = 0, count = 0;
+    begin();
+    for (word f = from; f <= to; f += step, ++count) {
+      rx.tuneAndWait(f, status);
+      stcCheck();
+      tuneUs += rx.getTuneTime();
+      rssi += status.RSSI;
+    }
+    report(name);
+    byte size;
+    rx.getAntCapTable(size);
+    printf("  pass%d tunes:%lu avg:%lu us RSSI avg:%.2f table:%u\n", pass, count, tuneUs / count,
+           (double)rssi / count, size);
+  }
+}
+
+static void antCapCheck() {  // 学習点の両側と間の補間を1/f^2の計算値と比べる
+  const tAntCap points[] = { {1000, 4000}, {1100, 3300} };
+  const word freqs[] = { 990, 1020, 1050, 1080, 1110, 1130 };
+  byte size;
+  const tAntCap *table = rx.getAntCapTable(size);
+  tAntCap saved[ANTCAP_TABLE_SIZE];
+  memcpy(saved, table, size * sizeof(tAntCap));
+  rx.setAntCapTable(points, 2);
+  int maxErr = 0;
+  for (word f : freqs) {
+    double w = (1.0 / f / f - 1e-6) / (1.0 / 1100 / 1100 - 1e-6);
+    int err = (int)rx.getAntCap(f) - (int)(4000 + (3300 - 4000) * w + 0.5);
+    err = err < 0 ? -err : err;
+    maxErr = err > maxErr ? err : maxErr;
+    printf("  %u:%u", f, rx.getAntCap(f));
+  }
+  printf("\nANTCAP interpolation max error:%d %s\n", maxErr, maxErr <= 2 ? "OK" : "NG");
+  rx.setAntCapTable(saved, size);
+}
+
+static void patchAsync(tRadio *r, byte abortAt, const char *name) {  // poll()1回の最長時間を測る
+  begin();
+  rx.setRadioAsync(r);
+  byte start = rx.getPatchProgress();  // 目印に届く前も0(ダウンロード中)
+  unsigned long polls = 0, maxPoll = 0;
+  while (rx.busy()) {
+    uint64_t t = simNowNs();
+    rx.poll();
+    unsigned long us = (simNowNs() - t) / 1000;
+    if (us > maxPoll)
+      maxPoll = us;
+    ++polls;
+    if (rx.getPatchProgress() >= abortAt && rx.getPatchProgress() < 100)
+      rx.patchAbort();  // 途中でバンドを切り替えた
+  }
+  report(name);
+  printf("  polls:%lu max poll:%lu us progress:%u->%u error:%d\n", polls, maxPoll, start, rx.getPatchProgress(), rx.getError());
+}
+
+static void patchHist(const char *name) {  // パッチ1レコード毎のCTS待ちの分布
+  unsigned long hist[8] = { 0 }, sum = 0, maxWait = 0, count = 0;
+  rx.powerDown();
+  begin();
+  rx.patchBegin();
+  for (byte progress = 0; progress < 100; ) {
+    unsigned long sent = simStats.patchRecords;
+    progress = rx.patchStep(1);
+    if (progress == PATCH_ERROR)
+      break;
+    if (simStats.patchRecords == sent)
+      continue;  // 最後のレコードの適用待ち
+    unsigned long wait = rx.getCtsWaitTime();
+    ++hist[wait / 50 < 7 ? wait / 50 : 7];
+    sum += wait;
+    maxWait = wait > maxWait ? wait : maxWait;
+    ++count;
+  }
+  report(name);
+  printf("  records:%lu ctsWait avg:%lu max:%lu us\n ", count, count ? sum / count : 0, maxWait);
+  for (byte i = 0; i < 7; ++i)
+    printf(" <%dus:%lu", (i + 1) * 50, hist[i]);
+  printf(" >=350us:%lu\n", hist[7]);
+}
+
+int main(int argc, char **argv) {
+  tRadio fm  = {FM,  8250, 0, 0,  7600, 10800, 10, true,  true, 0, 0, 0, 0};
+  tRadio mw  = {AM,   729, 0, 0,   522,  1710,  9, false, true, 0, 0, 0, 0};
+  tRadio sw1 = {AM,  5730, 0, 1,  5730,  6295,  5, false, true, 0, 0, 0, 0};
+  tRadio sw2 = {AM,  9250, 0, 1,  9250,  9900,  5, false, true, 0, 0, 0, 0};
+  tRadio lsb = {LSB, 7000, 0, 1,  7000,  7200,  1, false, true, 0, 0, 0, 0};
+  tRsqStatus rsq;
+  tTuneStatus tune;
+
+  simSetResetPin(RESET_PIN);
+#ifndef FLASHROMPATCH
+  loadEeprom(patchInit::addr, patchInit::patchId, patchInit::romData, sizeof(patchInit::romData));
+  loadEeprom(patchFull::addr, patchFull::patchId, patchFull::romData, sizeof(patchFull::romData));
+#endif
+  if (argc > 1)
+    simSetClock(atol(argv[1]));
+  rx.setup();
+  printf("I2C clock %lu Hz\n", simGetClock());
+  printf("%-22s %10s %10s %7s %7s %6s %4s\n", "api", "time(ms)", "bus(us)", "write", "read", "trans", "cts!");
+
+  begin(); rx.setRadio(&fm);      report("setRadio FM");
+  begin(); rx.setStereo(false);   report("setStereo");
+  begin(); rx.setVolume(40);      report("setVolume");
+  begin(); rx.getProperty(RX_VOLUME); report("getProperty");
+  begin(); rx.getProperty(0x1403); report("getProperty miss");  // FM_SEEK_TUNE_SNR_THRESHOLD シャドウなし
+  begin(); rx.setFreq(8470);      report("setFreq FM");
+  begin(); rx.getTuneStatus(false, tune); report("getTuneStatus");
+  begin(); rx.getRsqStatus(rsq);  report("getRsqStatus");
+  tuneWait(8010, "tuneAndWait FM");
+  begin();
+  rx.tuneAsync(8250);
+  while (!rx.tuneDone(tune))  // 待つ間もpoll()で他の処理ができる
+    rx.poll();
+  stcCheck();
+  report("tuneAsync FM");
+  printf("  tune:%lu us freq:%u\n", rx.getTuneTime(), tune.FREQ);
+  begin();
+  rx.seekStart(true);
+  while (rx.seekNow(false))
+    delay(1);
+  report("seek FM");
+  begin();
+  for (int i = 0; i < 500; ++i) {  // 2ms周期のメインループでRSQを表示する
+#ifdef INT_PIN
+    if (rx.getIntFlags() & RSQINT)  // RSSIが変化した時だけ読む
+      rx.getRsqStatus(rsq);
+#else
+    if ((i & 0xFF) == 0)  // 512ms毎に読む
+      rx.getRsqStatus(rsq);
+#endif
+    delay(2);
+  }
+  report("RSQ idle 1s");
+  spin(10, 50, "encoder spin 50 steps");  // 100kHz x 50
+  begin(); rx.setRadio(&mw);      report("setRadio AM MW");
+  delay(TUNE_INTERVAL);  // 前回のチューン完了後の1ステップ
+  begin(); rx.addFreq(9);         report("addFreq AM");
+  tuneWait(954, "tuneAndWait AM MW");
+  antCapCheck();
+  capScan(531, 1602, 9, "ANTCAP scan MW");
+  begin(); rx.setRadio(&sw1);     report("setRadio AM 49m");
+  tuneWait(6055, "tuneAndWait AM 49m");
+  capScan(5900, 6200, 5, "ANTCAP scan 49m");
+  begin(); rx.setRadio(&sw2);     report("setRadio AM 31m");
+  begin(); rx.setRadio(&lsb);     report("setRadio LSB");
+  tuneWait(7100, "tuneAndWait LSB");
+  delay(TUNE_INTERVAL);
+  begin(); rx.addFreq(10);        report("addFreq SSB 10Hz");
+  delay(TUNE_INTERVAL);
+  begin(); rx.addFreq(1500);      report("addFreq SSB 1.5kHz");
+  spin(100, 100, "SSB spin 100x100Hz");
+  begin(); rx.setFreqHz(7074350); report("setFreqHz SSB");
+  printf("  freq:%s %luHz\n", rx.getLabel(L_FREQ), (unsigned long)rx.getFreqHz());
+  sweep(&lsb, false, "sweep 7MHz 1x");
+  sweep(&lsb, true, "sweep 7MHz accel");
+  lsb.mode = USB;
+  begin(); rx.setRadio(&lsb);     report("setRadio LSB->USB");
+  lsb.mode = AM;
+  begin(); rx.setRadio(&lsb);     report("setRadio USB->AM");  // AM_ON_PATCH時はパッチのまま
+  lsb.mode = LSB;
+  begin(); rx.setRadio(&lsb);     report("setRadio AM->LSB");
+  rx.getError();
+  simInjectFault(2, 0);  // 2回失敗して再送で回復
+  begin(); rx.getRsqStatus(rsq);  report("getRsqStatus fault x2");
+  printf("  error:%d clears:%lu\n", rx.getError(), simStats.busClears - last.busClears);
+  simInjectFault(1000, I2C_TIMEOUT);  // バスが固まったまま(最悪停止時間)
+  begin(); rx.getRsqStatus(rsq);  report("getRsqStatus stuck");
+  printf("  error:%d clears:%lu\n", rx.getError(), simStats.busClears - last.busClears);
+  simInjectFault(0, 0);
+  rx.setRadio(&mw);
+  rx.setRadioAsync(&fm);
+  simInjectFault(1000, 0);  // 非同期の設定がすべて送信失敗
+  begin();
+  while (rx.poll());
+  report("setRadioAsync fault");
+  simInjectFault(0, 0);
+  byte valid = 0, props;
+  const tProperty *prop = rx.getPropertyTable(props);
+  for (byte i = 0; i < props; ++i)
+    valid += prop[i].valid;
+  printf("  error:%d shadow valid:%u %s\n", rx.getError(), valid, valid ? "NG" : "OK");
+
+  rx.setRadio(&fm);
+  patchAsync(&lsb, 100, "setRadioAsync LSB");
+  rx.setRadio(&fm);
+  patchAsync(&lsb, 50, "patch abort at 50%");
+  begin(); rx.setRadio(&fm);      report("setRadio FM after abort");
+  printf("  freq:%s\n", rx.getLabel(L_FREQ));
+
+  rx.powerDown();
+  begin();
+#ifdef FLASHROMPATCH
+  rx.patchFlashRomLoad();
+  report("patchFlashRomLoad");
+  patchVerify();
+  begin(); bool ok = rx.patchCheck(); report("patchCheck");
+  printf("  result:%d\n", ok);
+#else
+  rx.patchExtEepRomLoad();
+  report("patchExtEepRomLoad");
+  patchVerify();
+  rx.powerDown();
+  begin();
+  rx.patchExtEepRomLoad(patchFull::addr);
+  report("patchExtEepRomLoad full");
+  patchVerify();
+
+  begin(); bool ok = rx.patchCheck(); report("patchCheck");
+  printf("  result:%d\n", ok);
+  word badAddr = patchInit::addr + 32 + 4003;  // initパッチの1バイトを壊す
+  byte bad = patchInit::romData[4003] ^ 0x01;
+  simLoadEeprom(badAddr, &bad, 1);
+  begin(); ok = rx.patchCheck(); report("patchCheck bad image");
+  printf("  result:%d error:%d\n", ok, rx.getError());
+  rx.powerDown();
+  begin(); ok = rx.patchExtEepRomLoad(); report("patchExtEepRomLoad bad");
+  printf("  result:%d error:%d records sent:%lu/%u\n", ok, rx.getError(),
+         simStats.patchRecords - last.patchRecords, (unsigned)(sizeof(patchInit::romData) / 8));
+  simLoadEeprom(badAddr, &patchInit::romData[4003], 1);
+
+  const byte noCrc[4] = { 0 };  // CRC対応前のSi4732_eepromで書いたヘッダ
+  simLoadEeprom(patchInit::addr, noCrc, sizeof(noCrc));
+  simInjectEepromFault(500);  // 先読み中の読込みが途中で切れる
+  rx.powerDown();
+  begin(); ok = rx.patchExtEepRomLoad(); report("patchExtEepRomLoad fault");
+  printf("  result:%d faults:%lu\n", ok, simStats.faults - last.faults);
+  patchVerify();
+  loadEeprom(patchInit::addr, patchInit::patchId, patchInit::romData, sizeof(patchInit::romData));
+#endif
+  patchHist("patchStep(1) x all");
+  printf("\nSTC timeout:%lu %s\n", stcErrors, stcErrors ? "NG" : "OK");
+#ifdef STATS
+  byte size;
+  const tStats *st = rx.getStats(size);
+  printf("\nOP   count   write    read     total(us)   max(us)  ctsWait(us)\n");
+  for (byte i = 0; i < size; ++i, ++st)
+    printf("%02X %7lu %7lu %7lu %13lu %9lu %12lu\n", st->opcode, st->count, st->writeBytes,
+           st->readBytes, st->totalTime, st->maxTime, st->ctsWait);
+#endif
+  return stcErrors ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+/*
+  MockBusでTinySI4732をホスト上で動かす例
+  各モードのsetRadioで送受信したバイト数を表示する。
+*/
+#include <Arduino.h>
+#include "TinySI4732.h"
+
+extern unsigned long mockWriteBytes, mockReadBytes;
+
+int main() {
+  TinySI4732 rx(10);
+  tRadio radio[] = {
+    {FM, 8250, 0, 0,  7600, 10800, 10, true, true, 0, 0, 0, 0},
+    {AM,  729, 0, 0,   522,  1710,  9, false, true, 0, 0, 0, 0},
+    {LSB, 7000, 0, 1, 7000,  7200,  1, false, true, 0, 0, 0, 0},
+  };
+  rx.setup();
+  for (tRadio &r : radio) {
+    unsigned long w = mockWriteBytes, rd = mockReadBytes;
+    rx.setRadio(&r);
+    printf("%-3s write:%5lu read:%5lu\n", rx.getLabel(L_MODE), mockWriteBytes - w, mockReadBytes - rd);
+  }
+  return 0;
+}
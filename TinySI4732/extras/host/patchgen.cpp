@@ -0,0 +1,118 @@
+/*
+  圧縮したpatch.hを生成する(ホスト用)
+  Si4732_eepromのinit.h(オペコード付き8バイトのレコード)から、patchArgsと圧縮したpatchDataを出力する。
+
+  ビルド例(TinySI4732/extras/hostで実行)
+    g++ -std=gnu++11 -O2 -I. patchgen.cpp -o patchgen
+    ./patchgen > ../../src/patch.h
+
+  圧縮形式: 0の連続をPATCH_ESC,n(nは0の個数)に置き換える。PATCH_ESC自身はPATCH_ESC,0とする。
+  パッチの中身は暗号化されていて偏りがなく、スライド窓の辞書圧縮(LZ)ではほとんど縮まない。
+  0の連続だけを取り除くので、展開に窓のRAMは要らない。
+*/
+#include <Arduino.h>
+#include <vector>
+#include "../../examples/Si4732_eeprom/init.h"
+
+#define MIN_RUN 3  // これより短い0の連続はそのまま
+
+static std::vector<byte> pack(const std::vector<byte> &data, byte esc) {
+  std::vector<byte> out;
+  for (size_t i = 0; i < data.size(); ) {
+    size_t n = 0;
+    while (i + n < data.size() && data[i + n] == 0 && n < 255)
+      ++n;
+    if (n >= MIN_RUN) {
+      out.push_back(esc);
+      out.push_back(n);
+      i += n;
+    } else if (data[i] == esc) {
+      out.push_back(esc);
+      out.push_back(0);
+      ++i;
+    } else {
+      out.push_back(data[i++]);
+    }
+  }
+  return out;
+}
+
+static uint32_t crc32(const byte *data, size_t size) {  // TinySI4732, Si4732_eepromと同じCRC32
+  uint32_t crc = 0xFFFFFFFF;
+  while (size--) {
+    crc ^= *data++;
+    for (byte i = 0; i < 8; ++i)
+      crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320 : 0);
+  }
+  return ~crc;
+}
+
+static std::vector<byte> unpack(const std::vector<byte> &packed, byte esc) {  // TinySI4732::patchByte()と同じ展開
+  std::vector<byte> out;
+  for (size_t i = 0; i < packed.size(); ) {
+    byte c = packed[i++];
+    if (c != esc)
+      out.push_back(c);
+    else if (packed[i])
+      out.insert(out.end(), packed[i++], 0);
+    else
+      out.push_back(esc), ++i;
+  }
+  return out;
+}
+
+int main() {
+  std::vector<byte> data;  // オペコードを除いた7バイトのレコード
+  std::vector<byte> args;  // PATCH_ARGSから次のPATCH_ARGSまでのレコード数
+  const size_t records = sizeof(romData) / 8;
+  for (size_t r = 0; r < records; ++r) {
+    const byte *rec = &romData[r * 8];
+    if (rec[0] == 0x15) {
+      args.push_back(0);
+    } else if (rec[0] != 0x16 || args.empty()) {
+      fprintf(stderr, "record %zu: bad opcode 0x%02X\n", r, rec[0]);
+      return 1;
+    }
+    if (++args.back() == 0) {
+      fprintf(stderr, "record %zu: PATCH_ARGS block over 255 records\n", r);
+      return 1;
+    }
+    data.insert(data.end(), rec + 1, rec + 8);
+  }
+
+  size_t count[256] = { 0 };  // 一番少ない値をエスケープにする
+  for (byte c : data)
+    ++count[c];
+  byte esc = 1;
+  for (int c = 1; c < 256; ++c)
+    if (count[c] < count[esc])
+      esc = c;
+
+  std::vector<byte> packed = pack(data, esc);
+  if (unpack(packed, esc) != data) {
+    fprintf(stderr, "verify error\n");
+    return 1;
+  }
+
+  printf("#define FLASHROMPATCH\n");
+  printf("#define PATCH_RECORDS %zu  // パッチのレコード数\n", records);
+  printf("#define PATCH_ESC     0x%02X  // patchDataの0の連続の圧縮 PATCH_ESC,n:0がn個 PATCH_ESC,0:PATCH_ESC\n", esc);
+  printf("#define PATCH_CRC     0x%08XUL  // オペコード付き8バイトのレコードのCRC32\n", crc32(romData, sizeof(romData)));
+  printf("\n// extras/host/patchgen.cppでexamples/Si4732_eeprom/init.hから生成\n");
+  printf("const byte patchArgs[] PROGMEM = {");
+  for (size_t i = 0; i < args.size(); ++i)
+    printf("%s%u,", i % 25 ? " " : "\n  ", args[i]);
+  printf("\n};\n\n");
+  printf("// Vadim Afonkin(https://www.youtube.com/watch?v=fgjPGnTAVgM)氏がDropboxで公開しているパッチを使用しています。\n");
+  printf("// Vadim Afonkin氏に感謝します。\n\n");
+  printf("// Copyright 2012 Silicon Laboratories, Inc.\n");
+  printf("// Generated 11:01 August 15 2012\n");
+  printf("// amrx 6.0 build 1 - big Patch for whole SSBRX initialization string\n");
+  printf("const byte patchData[] PROGMEM = {    // %zubyte (圧縮前%zubyte)", packed.size(), data.size());
+  for (size_t i = 0; i < packed.size(); ++i)
+    printf("%s0x%02X,", i % 16 ? "" : "\n  ", packed[i]);
+  printf("\n};\n");
+  fprintf(stderr, "records:%zu args:%zu data:%zu -> %zu byte (esc 0x%02X)\n",
+          records, args.size(), data.size(), packed.size(), esc);
+  return 0;
+}
@@ -1,16 +1,78 @@
 #include <Arduino.h>
 #include "TinySI4732.h"
-#include <Wire.h>
-const int SI4732_ADDR = 0x11;  // si4732
-const int EEPROM_ADDR = 0x50;  // Extern eeprom
+typedef SI4732_BUS Bus;        // I2Cトランスポート
+const byte EEPROM_ADDR = 0x50; // Extern eeprom
+#ifndef FLASHROMPATCH
+const word EEPROM_SIZE = 0x8000;  // 24C256
+const word patchSlots[] = { 0x0000, 0x4000 };  // Si4732_eepromのパッチの書込み位置 init, full
+#endif
+#ifdef INT_PIN
+const byte GPO2OEN = 0b01000000;  // POWER_UP GPO2/INT出力を有効にする
+volatile bool TinySI4732::intFlag;
+#else
+const byte GPO2OEN = 0;
+#endif
+const uint32_t crcTable[] PROGMEM = {  // CRC32(0xEDB88320) 4ビット毎
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+static uint32_t crc32(uint32_t crc, const byte *data, byte size) {  // 初期値0xFFFFFFFF、最後に反転する
+  while (size--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ pgm_read_dword(&crcTable[crc & 0x0F]);
+    crc = (crc >> 4) ^ pgm_read_dword(&crcTable[crc & 0x0F]);
+  }
+  return crc;
+}
+#ifndef FLASHROMPATCH
+static uint32_t patchHeaderCrc(const byte *header) {  // patch_crc(reserved[0..3]) リトルエンディアン
+  return ((uint32_t)header[3] << 24) | ((uint32_t)header[2] << 16) | ((word)header[1] << 8) | header[0];
+}
+#endif
+const byte patchPowerUp[] = { POWER_UP, (byte)(0b00110001 | GPO2OEN), 0b00000101 };  // PATCH, AM
 
-TinySI4732::TinySI4732(byte RESET_PIN) {
+TinySI4732::TinySI4732(byte RESET_PIN, byte i2cAddr) {
   this->RESET_PIN = RESET_PIN;
+  this->i2cAddr = i2cAddr;
   for(byte i = 0; i < LABEL_SIZE; ++i)
     radioLabel[i][0] = '\0';
+  queueHead = queueCount = 0;
+  queueState = Q_IDLE;
+  async = false;
+  propertyCount = 0;
+  lastError = SI4732_OK;
+  intStatus = 0;
+  resWaitTime = 0;
+  tunePending = false;
+  tuneWait = false;
+  tuneLatency = 0;
+  accelLevel = accelCount = 0;
+  accelDir = 0;
+  accelMax[FM] = accelMax[AM] = 1;       // FM:1MHz, AM:90kHz(9kHzステップ)まで
+  accelMax[LSB] = accelMax[USB] = 2;     // SSB:10kHzまで
+  antCapCount = 0;
+  antCapAuto = false;
+  mode = FM;
+  powerFunc = 0xFF;
+  patchPos = patchSize = 0;
+  patchAhead = false;
+  patchProgress = 100;
+  agcCmd[0] = 0;
+#ifdef TRACE
+  traceHead = traceCount = 0;
+#endif
+#ifdef STATS
+  statsCount = 0;
+  statWrite = statRead = 0;
+#endif
 }
 
 void TinySI4732::reset() {
+  queueCount = 0;  // 未処理の非同期コマンドは破棄
+  queueState = Q_IDLE;
+  clearProperty();  // プロパティは初期値に戻る
+  powerFunc = 0xFF;
+  intStatus = 0;
   digitalWrite(RESET_PIN, LOW);
   delay(10);
   digitalWrite(RESET_PIN, HIGH);
@@ -18,19 +80,15 @@ void TinySI4732::reset() {
 }
 
 void TinySI4732::setup() {
-  Wire.begin();
-  Wire.setClock(400000);
+  Bus::begin(400000);
   pinMode(RESET_PIN, OUTPUT);
   reset();
+#ifdef INT_PIN
+  pinMode(INT_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(INT_PIN), intHandler, FALLING);
+#endif
 }
 
-#ifdef DEBUG
-void dbOut(byte data, bool wt = true) {
-  if (!wt) Serial.print("\t");
-  if (data < 16) Serial.print("0");
-  Serial.println(data, HEX);
-}
-#endif
 /*
   STATUS 戻り値
   7 CTS 送信可。
@@ -39,7 +97,10 @@ void dbOut(byte data, bool wt = true) {
   6 ERR エラー。
     0 = エラーなし
     1 = エラー
-  5:3 予約済み 値は異なる場合があります。
+  5:4 予約済み 値は異なる場合があります。
+  3 RSQINT 受信信号品質割り込み。
+    0 = RSQ 割り込みはトリガーされていません。
+    1 = RSQ 割り込みがトリガーされました。
   2 RDSINT RDS 割り込み。
     0 = RDS 割り込みはトリガーされていません。
     1 = RDS 割り込みがトリガーされました。
@@ -52,44 +113,401 @@ void dbOut(byte data, bool wt = true) {
 */
 template<typename T1, typename T2>
 byte TinySI4732::commandOut(const T1 &cmd, T2 &response) {  // コマンド出力
-  commandOut(cmd);
-
-  byte *resAry = (byte *)&response;
-  Wire.requestFrom(SI4732_ADDR, sizeof(T2));
-  for (byte i = 0; i < sizeof(T2); ++i) {
-    resAry[i] = Wire.read();
-    #ifdef DEBUG
-    dbOut(resAry[i], false);
-    #endif
-  }
-  return resAry[0];  // STATUS
+  while (poll());  // 非同期コマンドを掃き出してから実行
+  return sendCommand((const byte *)&cmd, sizeof(T1), (byte *)&response, sizeof(T2));
 }
 
 template<typename T1>
 byte TinySI4732::commandOut(const T1 &cmd) {  // コマンド出力
-  const byte *cmdAry = (const byte *)&cmd;
-  Wire.beginTransmission(SI4732_ADDR);
-  Wire.write(cmdAry, sizeof(T1));
-#ifdef DEBUG
-  for (byte i = 0; i < sizeof(T1); ++i)
-    dbOut(cmdAry[i]);
+  if (async) {  // 非同期時はキューに登録してpoll()で出力する
+    submit((const byte *)&cmd, sizeof(T1));
+    return 0x80;  // CTS
+  }
+  while (poll());  // 非同期コマンドを掃き出してから実行
+  return sendCommand((const byte *)&cmd, sizeof(T1));
+}
+
+byte TinySI4732::sendCommand(const byte *cmd, byte size, byte *response, byte resSize) {  // コマンドを送信しCTSを待つ
+#if defined(TRACE) || defined(STATS)
+  unsigned long startTime = micros();
+#endif
+#ifdef STATS
+  statMark();
+#endif
+  byte status = 0x40;  // ERROR 送信失敗
+  if (busWrite(i2cAddr, cmd, size) == 0)
+    status = waitCts(cmd[0], response, resSize);  // 応答はSTATUSと同じトランザクションで読む
+#ifdef TRACE
+  trace(cmd, size, status, resSize, startTime);
 #endif
+  if (resSize) {
+    if (!(status & 0x80))
+      memset(response, 0, resSize);
+    status = response[0] = response[0] | (status & 0x40);
+  }
+#ifdef STATS
+  countStats(cmd[0], micros() - startTime);
+#endif
+  return status;  // STATUS
+}
 
-  Wire.endTransmission();
-  if (cmdAry[0] == POWER_UP)
-    delay(110);  // tCTS
-  else
-    delayMicroseconds(300);  // tCTS
+/*
+  I2Cの送受信
+  失敗時はI2C_RETRY回まで再送する。バックオフは100us, 200us, 400usで、
+  2回目以降の再送前にはバスクリアを行う。最悪停止時間はTinySI4732Bus.hを参照。
+*/
+byte TinySI4732::busWrite(byte addr, const byte *buf, byte size) {  // I2C書込み 戻り値 0:正常
+  byte err;
+  for (byte retry = 0; ; ++retry) {
+#ifdef STATS
+    statWrite += size;
+#endif
+    err = Bus::write(addr, buf, size);
+    if (err == 0 || retry >= I2C_RETRY)
+      break;
+    if (retry)
+      Bus::clear();
+    delayMicroseconds(100 << retry);  // バックオフ
+  }
+  if (err)
+    lastError = SI4732_ERR_I2C;
+  return err;
+}
 
-  Wire.requestFrom(SI4732_ADDR, 1);
-  byte status = Wire.read();
-  #ifdef DEBUG
-  dbOut(status, false);
-  #endif
+byte TinySI4732::busRead(byte addr, byte *buf, byte size) {  // I2C読込み 戻り値:読込んだバイト数
+  byte n;
+  for (byte retry = 0; ; ++retry) {
+#ifdef STATS
+    statRead += size;
+#endif
+    n = Bus::read(addr, buf, size);
+    if (n == size || retry >= I2C_RETRY)
+      break;
+    if (retry)
+      Bus::clear();
+    delayMicroseconds(100 << retry);  // バックオフ
+  }
+  if (n != size) {
+    lastError = SI4732_ERR_I2C;
+    memset(buf + n, 0, size - n);  // 読めなかった分はCTS=0として扱う
+  }
+  return n;
+}
+
+byte TinySI4732::getError() {  // 最後のエラーを返してクリアする
+  byte err = lastError;
+  lastError = SI4732_OK;
+  return err;
+}
+
+static unsigned long ctsTime(byte opcode) {  // CTS待ち時間(us) CTSPOLLING時はタイムアウト時間
+#ifdef CTSPOLLING
+  return opcode == POWER_UP ? 500000 : 10000;
+#else
+  return opcode == POWER_UP ? 110000 : 300;  // tCTS
+#endif
+}
+
+/*
+  CTSの待機
+  応答付きのコマンドはSTATUSと応答を毎回まとめて読み、CTS=1の読込みをそのまま応答とする。
+  STATUSを読んでから応答を読み直すより1トランザクション少ない。CTSPOLLING時は最初の
+  読込みをresWaitTimeだけ遅らせて、応答長の空読みを減らす。resWaitTimeは1回で読めたら
+  1/8ずつ縮め、読み直した時はCTSが立った読込みの開始時間にする。
+*/
+byte TinySI4732::waitCts(byte opcode, byte *response, byte resSize) {
+  unsigned long startTime = micros();
+  byte status;
+  if (!resSize) {  // 応答なしはSTATUSだけ読む
+    response = &status;
+    resSize = 1;
+  }
+#ifdef CTSPOLLING
+  // CTS(bit7)が立つまで読み直す。タイムアウト時はCTS=0のまま返す
+  unsigned long readTime;
+  byte count = 0;
+  if (resSize > 1)
+    delayMicroseconds(resWaitTime);
+  do {
+    readTime = micros() - startTime;
+    busRead(i2cAddr, response, resSize);
+    ctsWaitTime = micros() - startTime;
+    ++count;
+  } while (!(response[0] & 0x80) && ctsWaitTime < ctsTime(opcode));
+  if (resSize > 1 && (response[0] & 0x80))  // 最初の読込みまでの待ち時間を学習
+    resWaitTime = count > 1 ? readTime : resWaitTime - resWaitTime / 8;
+#else
+  if (opcode == POWER_UP)
+    delay(ctsTime(opcode) / 1000);
+  else
+    delayMicroseconds(ctsTime(opcode));
+  ctsWaitTime = micros() - startTime;
+  busRead(i2cAddr, response, resSize);
+#endif
+  status = response[0];
+  if (!(status & 0x80))
+    lastError = SI4732_ERR_CTS;
+  else if (status & 0x40)
+    lastError = SI4732_ERR_STATUS;
   return status;  // STATUS
 }
 
+unsigned long TinySI4732::getCtsWaitTime() {
+  return ctsWaitTime;
+}
+
+#ifdef TRACE
+/*
+  トランザクショントレース
+  コマンド毎にオペコードと引数、STATUS、応答長、開始時刻、CTS待ち時間をリングバッファに記録する。
+  シリアル出力しないので処理時間への影響は小さい。TRACE未定義時はコードを生成しない。
+*/
+void TinySI4732::trace(const byte *cmd, byte cmdSize, byte status, byte resSize, unsigned long startTime) {
+  tTrace &t = traceBuf[traceHead];
+  traceHead = (traceHead + 1) % TRACE_SIZE;
+  if (traceCount < TRACE_SIZE)
+    ++traceCount;
+  t.cmdSize = cmdSize < sizeof(t.cmd) ? cmdSize : sizeof(t.cmd);
+  memcpy(t.cmd, cmd, t.cmdSize);
+  t.status = status;
+  t.resSize = resSize;
+  t.startTime = startTime;
+  t.ctsWait = ctsWaitTime;
+}
+
+byte TinySI4732::getTraceSize() {
+  return traceCount;
+}
+
+const tTrace *TinySI4732::getTrace(byte n) {  // n=0が最も古い記録
+  if (n >= traceCount)
+    return nullptr;
+  return &traceBuf[(traceHead + TRACE_SIZE - traceCount + n) % TRACE_SIZE];
+}
+
+void TinySI4732::clearTrace() {
+  traceCount = 0;
+}
+#endif
+
+#ifdef STATS
+/*
+  オペコード毎の統計
+  呼出し回数、書込み・読込みバイト数(CTSポーリングを含む)、処理時間の累計と最大、CTS待ち時間の累計を数える。
+*/
+void TinySI4732::statMark() {  // 計測開始時のバイト数を記録
+  statMarkWrite = statWrite;
+  statMarkRead = statRead;
+}
+
+void TinySI4732::countStats(byte opcode, unsigned long time) {
+  tStats *st = nullptr;
+  for (byte i = 0; i < statsCount; ++i)
+    if (statsBuf[i].opcode == opcode)
+      st = &statsBuf[i];
+  if (!st) {
+    if (statsCount >= STATS_SIZE)
+      return;  // 満杯の時は数えない
+    st = &statsBuf[statsCount++];
+    memset(st, 0, sizeof(tStats));
+    st->opcode = opcode;
+  }
+  ++st->count;
+  st->writeBytes += statWrite - statMarkWrite;
+  st->readBytes += statRead - statMarkRead;
+  st->totalTime += time;
+  if (time > st->maxTime)
+    st->maxTime = time;
+  st->ctsWait += ctsWaitTime;
+}
+
+const tStats *TinySI4732::getStats(byte &size) {
+  size = statsCount;
+  return statsBuf;
+}
+
+void TinySI4732::clearStats() {
+  statsCount = 0;
+}
+#endif
+
+/*
+  非同期コマンドエンジン
+  submit()でコマンドと応答格納先をキューに登録し、poll()を繰り返し呼び出して
+  送信 → CTS待ち → 応答読込み(SET_PROPERTYはtCOMP待ち)の順に処理を進める。
+  poll()は待ち時間中に戻るので、呼び出し側はLCD更新等を継続できる。
+*/
+bool TinySI4732::submit(const byte *cmd, byte cmdSize, byte *response, byte resSize) {  // コマンドをキューに登録
+  if (cmdSize > sizeof(cmdQueue[0].cmd))
+    return false;
+  while (queueCount >= CMDQUEUE_SIZE)  // キューが満杯の時は空くまで処理する
+    poll();
+  tCommand &c = cmdQueue[(queueHead + queueCount) % CMDQUEUE_SIZE];
+  memcpy(c.cmd, cmd, cmdSize);
+  c.cmdSize = cmdSize;
+  c.response = response;
+  c.resSize = response ? resSize : 0;
+  ++queueCount;
+  return true;
+}
+
+byte TinySI4732::poll() {  // 非同期コマンドの処理を進める
+  if (!queueCount) {
+    tuneService(true);  // キューが空いたら保留中のチューンを出力
+    return queueCount;
+  }
+  tCommand &c = cmdQueue[queueHead];
+  unsigned long elapsed = micros() - queueTime;
+  byte status;
+
+  if (c.cmd[0] == PATCH_ARGS) {  // パッチの目印 PATCH_STEP個ずつ送り、最後は10ms待つ
+    if (queueState == Q_IDLE) {
+      if (!patchStart((c.cmd[1] << 8) | c.cmd[2])) {
+        patchError();
+        lastError = SI4732_ERR_PATCH;
+        return queueCount;  // リセットでキューは破棄済み
+      }
+      queueState = Q_CTS;
+    }
+    byte progress = patchStep(PATCH_STEP);  // 最後の適用待ちは99のまま返る
+    if (progress < 100 || progress == PATCH_ERROR)
+      return queueCount;  // エラー時はリセットでキューは破棄済み
+    queueState = Q_IDLE;
+    queueHead = (queueHead + 1) % CMDQUEUE_SIZE;
+    return --queueCount;
+  }
+
+  switch (queueState) {
+    case Q_IDLE:  // コマンド送信
+#ifdef STATS
+      statMark();
+      statTime = micros();
+#endif
+      if (busWrite(i2cAddr, c.cmd, c.cmdSize)) {
+        if (c.cmd[0] == SET_PROPERTY)
+          dropProperty((c.cmd[2] << 8) | c.cmd[3]);  // 先に登録したシャドウは設定されていない
+        break;  // 送信失敗のコマンドは破棄
+      }
+      queueTime = micros();
+      queueState = Q_CTS;
+      return queueCount;
+
+    case Q_CTS: {  // CTS待ち 応答付きはSTATUSと応答をまとめて読む
+      byte *res = c.resSize ? c.response : &status;
+#ifdef CTSPOLLING
+      if (c.resSize > 1 && elapsed < resWaitTime)
+        return queueCount;
+      busRead(i2cAddr, res, c.resSize ? c.resSize : 1);
+      status = res[0];
+      if (!(status & 0x80) && elapsed < ctsTime(c.cmd[0]))
+        return queueCount;
+#else
+      if (elapsed < ctsTime(c.cmd[0]))
+        return queueCount;
+      busRead(i2cAddr, res, c.resSize ? c.resSize : 1);
+      status = res[0];
+#endif
+      ctsWaitTime = elapsed;
+      if (!(status & 0x80))
+        lastError = SI4732_ERR_CTS;
+      else if (status & 0x40)
+        lastError = SI4732_ERR_STATUS;
+#ifdef TRACE
+      trace(c.cmd, c.cmdSize, status, c.resSize, queueTime);
+#endif
+      if (c.resSize && !(status & 0x80))
+        memset(c.response, 0, c.resSize);
+      if (c.cmd[0] == SET_PROPERTY && (status & 0xC0) != 0x80) {
+        dropProperty((c.cmd[2] << 8) | c.cmd[3]);  // CTSタイムアウト、エラー時は設定値が不明
+      } else if (c.cmd[0] == SET_PROPERTY) {
+#ifdef CTSPOLLING
+        storePropertyTime((c.cmd[2] << 8) | c.cmd[3], elapsed);  // CTSで完了
+#else
+        queueTime = micros();
+        queueState = Q_COMP;
+        return queueCount;
+#endif
+      }
+      break;
+    }
+
+    case Q_COMP:  // tCOMP待ち
+      if (elapsed < 10000)
+        return queueCount;
+      storePropertyTime((c.cmd[2] << 8) | c.cmd[3], ctsWaitTime + elapsed);
+      break;
+  }
+#ifdef STATS
+  countStats(c.cmd[0], micros() - statTime);
+#endif
+  queueState = Q_IDLE;
+  queueHead = (queueHead + 1) % CMDQUEUE_SIZE;
+  return --queueCount;
+}
+
+bool TinySI4732::busy() {
+  return queueCount != 0;
+}
+
+/*
+  プロパティのシャドウ
+  電源投入中に設定・取得したプロパティ値を保持し、同じ値の設定は送信を省略する。
+  getPropertyもシャドウにあればチップに問い合わせない。powerDown、resetで破棄する。
+  非同期の設定は登録を先に行い、poll()で送信失敗、CTSタイムアウト、エラーになったら破棄する。
+  設定の完了時間(送信からCTSまたはtCOMP経過まで)の最大値は電源を切っても保持する。
+*/
+tProperty *TinySI4732::findProperty(word property) {  // シャドウの検索
+  for (byte i = 0; i < propertyCount; ++i)
+    if (propertyCache[i].property == property)
+      return &propertyCache[i];
+  return nullptr;
+}
+
+void TinySI4732::storeProperty(word property, word data) {  // シャドウへの登録
+  tProperty *cache = findProperty(property);
+  if (!cache) {
+    if (propertyCount >= PROPERTY_CACHE_SIZE)
+      return;  // 満杯の時は登録しない
+    cache = &propertyCache[propertyCount++];
+    cache->property = property;
+    cache->compTime = 0;
+  }
+  cache->value = data;
+  cache->valid = true;
+}
+
+void TinySI4732::dropProperty(word property) {  // シャドウの無効化
+  tProperty *cache = findProperty(property);
+  if (cache)
+    cache->valid = false;
+}
+
+void TinySI4732::storePropertyTime(word property, unsigned long time) {  // 完了時間の登録
+  tProperty *cache = findProperty(property);
+  if (cache && time > cache->compTime)
+    cache->compTime = time > 0xFFFF ? 0xFFFF : time;
+}
+
+void TinySI4732::clearProperty() {  // シャドウの破棄
+  for (byte i = 0; i < propertyCount; ++i)
+    propertyCache[i].valid = false;
+  agcCmd[0] = 0;  // AGCも初期値に戻る
+}
+
+word TinySI4732::getPropertyTime(word property) {
+  tProperty *cache = findProperty(property);
+  return cache ? cache->compTime : 0;
+}
+
+const tProperty *TinySI4732::getPropertyTable(byte &size) {
+  size = propertyCount;
+  return propertyCache;
+}
+
 byte TinySI4732::setProperty(word property, word data) {
+  tProperty *cache = findProperty(property);
+  if (cache && cache->valid && cache->value == data)
+    return 0x80;  // 設定済みなので送信しない
   byte cmd[] = {
     SET_PROPERTY,
     0,
@@ -98,12 +516,26 @@ byte TinySI4732::setProperty(word property, word data) {
     highByte(data),
     lowByte(data),
   };
+  unsigned long startTime = micros();
   byte status = commandOut(cmd);
+  if (async) {  // 完了はpoll()で待つ
+    storeProperty(property, data);
+    return status;
+  }
+#ifndef CTSPOLLING
   delay(10);  // tCOMP
+#endif
+  if ((status & 0xC0) == 0x80) {  // CTSあり、エラーなしで完了
+    storeProperty(property, data);
+    storePropertyTime(property, micros() - startTime);
+  }
   return status;
 }
 
 word TinySI4732::getProperty(word property) {
+  tProperty *cache = findProperty(property);
+  if (cache && cache->valid)
+    return cache->value;
   byte cmd[] = {
     GET_PROPERTY,
     0,
@@ -111,20 +543,31 @@ word TinySI4732::getProperty(word property) {
     lowByte(property),
   };
   byte res[4];
-  commandOut(cmd, res);
-  return (res[2] << 8) | res[3];
+  word data;
+  if (commandOut(cmd, res) & 0x40)
+    return 0;  // ERROR
+  data = (res[2] << 8) | res[3];
+  storeProperty(property, data);
+  return data;
 }
 
 byte TinySI4732::powerUp(byte func) {
   byte cmd[] = {
     POWER_UP,
-    (byte)(0b00010000 | func),
+    (byte)(0b00010000 | GPO2OEN | func),
     0b00000101,
   };
-  return commandOut(cmd);
+  powerFunc = 0xFF;  // setRadioで設定する
+  byte status = commandOut(cmd);
+#ifdef INT_PIN
+  setupInt();
+#endif
+  return status;
 }
 
 byte TinySI4732::powerDown() {
+  clearProperty();  // シャドウの破棄
+  powerFunc = 0xFF;
   return commandOut((const byte[]){ POWER_DOWN });
 }
 
@@ -134,14 +577,38 @@ byte TinySI4732::getRev(tGetRev &rev) {
   return status;
 }
 
+/*
+  バンド切替
+  POWER_DOWN, POWER_UP(SSBはパッチのダウンロード)はチップの機能(FM, AM, SSB)が変わる時だけ行う。
+  同じ機能のバンド間(AM 49m→31m, LSB→USBなど)は電源を入れたままにし、プロパティはシャドウ、
+  AGCは前回の送信値と比べて変わったものだけを送信する。チューンは常に行う。
+  AM_ON_PATCH定義時は、パッチ適用中のAMはパッチのままAM_TUNE_FREQ(USBLSB=00)で受信する。
+  パッチはAMの復調も持つので、AM⇔LSB/USBの切替はモードのプロパティとチューンだけになる。
+  FMからのAMはパッチなしで起動する(パッチは最初にSSBにした時に読み込む)。
+*/
 void TinySI4732::setRadio(tRadio *radio) {
   rx = radio;
+  tunePending = false;  // setRadioでチューンする
+#ifdef INT_PIN
   byte pastMode = mode;
+#endif
   mode = rx->mode = rx->mode > USB ? FM : rx->mode;
+  byte func = mode < LSB ? mode : LSB;  // 0:FM, 1:AM, 2:SSB
+#ifdef AM_ON_PATCH
+  if (mode == AM && powerFunc == LSB)
+    func = LSB;  // パッチのままAMを受信する
+#endif
+  bool powerCycle = func != powerFunc;
   strcpy(radioLabel[L_MODE], (const char *[]){ "FM", "AM", "LSB", "USB" }[mode]);
+#ifdef INT_PIN
+  if (!powerCycle && (pastMode == AM) != (mode == AM))
+    setupInt();  // AM⇔SSBはRSQ割り込みのプロパティが変わる
+#endif
   if (mode == FM) {
-    powerDown();
-    powerUp(0b00010000);  // FM
+    if (powerCycle) {
+      powerDown();
+      powerUp(0b00010000);  // FM
+    }
     setProperty(FM_SEEK_BAND_TOP, rx->maxFreq);
     setProperty(FM_SEEK_BAND_BOTTOM, rx->minFreq);
     setProperty(FM_SEEK_FREQ_SPACING, rx->stepFreq);
@@ -150,20 +617,35 @@ void TinySI4732::setRadio(tRadio *radio) {
     setFreq(rx->freq, rx->fmAmAntCap);
     setFilter(rx->fmAmFilter);
   } else if (mode == AM) {
-    powerDown();
-    powerUp(0b00010001);  // AM
+    if (powerCycle) {
+      powerDown();
+      powerUp(0b00010001);  // AM
+    }
     setProperty(AM_SEEK_BAND_TOP, rx->maxFreq);
     setProperty(AM_SEEK_BAND_BOTTOM, rx->minFreq);
     setProperty(AM_SEEK_FREQ_SPACING, rx->stepFreq);
     setFreq(rx->freq, rx->fmAmAntCap);
     setFilter(rx->fmAmFilter);
   } else {
-    if (pastMode < LSB) {  // FM or AM
+    if (powerCycle) {  // FM, パッチなしのAMから
       powerDown();
-      #ifdef FLASHROMPATCH
-      patchFlashRomLoad();  // SSB patch download
-      #else
-      patchExtEepRomLoad(0x0000);  // SSB patch download 0x4000
+      if (async) {  // poll()でPATCH_STEP個ずつ送る
+        commandOut(patchPowerUp);
+        const byte mark[] = { PATCH_ARGS, highByte(PATCH_AUTO), lowByte(PATCH_AUTO) };  // パッチの目印 [1],[2]:外部EEPROMのアドレス
+        submit(mark, sizeof(mark));
+        patchPos = patchSize = 0;  // 目印に届いてpatchStartするまで進捗0のまま
+        patchProgress = 0;
+      } else {
+        #ifdef FLASHROMPATCH
+        bool loaded = patchFlashRomLoad();  // SSB patch download
+        #else
+        bool loaded = patchExtEepRomLoad();  // SSB patch download init:0x0000, full:0x4000
+        #endif
+        if (!loaded)
+          func = 0xFF;  // 次のsetRadioで電源から入れ直す
+      }
+      #ifdef INT_PIN
+      setupInt();
       #endif
     }
     setFreq(rx->freq, rx->ssbAntCap);
@@ -175,6 +657,13 @@ void TinySI4732::setRadio(tRadio *radio) {
   setVolume(volume);
   setMute(mute);
   seek = false;
+  powerFunc = func;
+}
+
+void TinySI4732::setRadioAsync(tRadio *radio) {  // setRadioをキュー経由で実行する。完了はpoll()で確認
+  async = true;
+  setRadio(radio);
+  async = false;
 }
 
 byte TinySI4732::setFreq(word freq) {
@@ -183,6 +672,8 @@ byte TinySI4732::setFreq(word freq) {
 
 byte TinySI4732::setFreq(word freq, word antCap) {
   byte state;
+  tuneStartTime = micros();
+  tuneWait = true;
   if (mode == FM) {
     freq = constrain(freq, 6400, 10800);
     antCap = constrain((int)antCap, 0, 191);
@@ -192,79 +683,296 @@ byte TinySI4732::setFreq(word freq, word antCap) {
       (byte)antCap,
     };
     state = commandOut(fmCmd);
+    antCapAuto = false;
     rx->fmAmAntCap = antCap;
     sprintf(radioLabel[L_FREQ], "%d.%0dM", freq / 100, freq % 100 / 10);
   } else if (mode == AM) {
     freq = constrain(freq, 149, 23000);
     antCap = constrain((int)antCap, 0, 6143);
+    word cap = antCap ? antCap : getAntCap(freq);  // autoは学習値で置き換える
     byte amCmd[] = {
-      AM_TUNE_FREQ,     0,
+      AM_TUNE_FREQ,     0,  // パッチ適用中はUSBLSB=00でAM
       highByte(freq),   lowByte(freq),
-      highByte(antCap), lowByte(antCap),
+      highByte(cap),    lowByte(cap),
     };
     state = commandOut(amCmd);
+    antCapAuto = !cap;
     rx->fmAmAntCap = antCap;
     sprintf(radioLabel[L_FREQ], "%d.0k", freq);
   } else {  // SSB
     freq = constrain(freq, 520, 30000);
-    if (freq < 2300)
-      antCap = constrain((int)antCap, 0, 6143);
-    else
-      antCap = constrain((int)antCap, 1, 6143);
+    antCap = constrain((int)antCap, 0, 6143);
+    word cap = antCap ? antCap : getAntCap(freq);
+    if (!cap && freq >= 2300)
+      cap = 1;  // 2300kHz以上はautoなし
     byte ssbCmd[] = {
       SSB_TUNE_FREQ,
       (byte)(mode == USB ? 0b10000000 : 0b01000000),
       highByte(freq),   lowByte(freq),
-      highByte(antCap), lowByte(antCap),
+      highByte(cap),    lowByte(cap),
     };
     state = commandOut(ssbCmd);
+    antCapAuto = !cap;
     rx->ssbAntCap = antCap;
-    sprintf(radioLabel[L_FREQ], "%d.%01dk", freq, rx->bfoFreq / 100);
+    ssbLabel(freq);
   }
   rx->freq = freq;
+  tuneTime = millis();
+  intStatus &= ~STCINT;  // 前回のチューン完了はTUNEでクリアされる
   return state;
 }
 
 byte TinySI4732::setBfoFreq(int bfoFreq) {
   rx->bfoFreq = constrain(bfoFreq, -16383, 16383);
-  sprintf(radioLabel[L_FREQ], "%d.%01dk", rx->freq, rx->bfoFreq / 100);
-  return setProperty(SSB_BFO, bfoFreq);
+  ssbLabel(rx->freq);
+  return setProperty(SSB_BFO, rx->bfoFreq);
+}
+
+/*
+  Hz単位の周波数
+  tRadio::freqはモード毎の単位(FM:10kHz, AM/SSB:1kHz)で、SSBの1kHz未満はbfoFreqに持つ。
+  EEPROMに保存したtRadioとの互換のため形式は変えず、Hzとの変換は乗除算1回で行う。
+*/
+byte TinySI4732::setFreqHz(uint32_t hz) {
+  tunePending = false;  // 保留中のチューンを置き換える
+  if (mode == FM)
+    return setFreq((constrain(hz, 64000000UL, 108000000UL) + 5000) / 10000);
+  hz = constrain(hz, 149000UL, 30000000UL);  // wordに収める。チップの範囲はsetFreqで制限する
+  word freq = (hz + 500) / 1000;  // 最寄りのkHz
+  if (mode >= LSB)
+    setBfoFreq((long)hz - freq * 1000L);  // 残りはBFO
+  return setFreq(freq);
+}
+
+uint32_t TinySI4732::getFreqHz() {
+  if (mode == FM)
+    return rx->freq * 10000UL;
+  return rx->freq * 1000UL + (mode >= LSB ? rx->bfoFreq : 0);
+}
+
+void TinySI4732::ssbLabel(word freq) {  // SSBの周波数表示 キャリア+BFO
+  long hz = freq * 1000L + rx->bfoFreq;
+  snprintf(radioLabel[L_FREQ], sizeof(radioLabel[0]), "%u.%uk", (word)(hz / 1000), (byte)(hz % 1000 / 100));
 }
 
 void TinySI4732::addFreq(int addFreq){  // UNIT FM:0.01MHz, AM:1kHz, SSB:1Hz
   if(mode < LSB){ // FM, AM
     rx->freq += addFreq;
     rx->freq = constrain(rx->freq, rx->minFreq, rx->maxFreq);
-  }else{  // LSB, USB
-    do{
-      if(addFreq >= 1000){
-        addFreq -= 1000;
-        ++rx->freq;
-      }else if(addFreq <= -1000){
-        addFreq += 1000;
-        --rx->freq;
-      }else{
-        rx->bfoFreq += addFreq;
-        if(rx->bfoFreq >= 1000){
-          rx->bfoFreq -= 1000;
-          ++rx->freq;
-        }else if(rx->bfoFreq < 0){
-          rx->bfoFreq += 1000;
-          --rx->freq;
-        }
-        addFreq = 0;
-      }
-    }while(addFreq);
-    if(rx->freq >= rx->maxFreq){
-      rx->freq = rx->maxFreq;
-      rx->bfoFreq = 0;
-    }else if(rx->freq < rx->minFreq){
-      rx->freq = rx->minFreq;
-      rx->bfoFreq = 0;
+    if(mode == FM)  // 表示はすぐに更新する
+      sprintf(radioLabel[L_FREQ], "%d.%0dM", rx->freq / 100, rx->freq % 100 / 10);
+    else
+      sprintf(radioLabel[L_FREQ], "%d.0k", rx->freq);
+  }else{  // LSB, USB キャリアはそのままでBFO_WINDOW内はBFOだけ動かす
+    long hz = rx->freq * 1000L + rx->bfoFreq + addFreq;  // 受信周波数(Hz)
+    hz = constrain(hz, rx->minFreq * 1000L, rx->maxFreq * 1000L);
+    long bfo = hz - rx->freq * 1000L;
+    if(bfo > BFO_WINDOW || bfo < -BFO_WINDOW){  // 窓の外は最寄りのkHzでチューンし直す
+      rx->freq = (hz + 500) / 1000;
+      rx->bfoFreq = hz - rx->freq * 1000L;
+    }else{
+      rx->bfoFreq = bfo;
+      ssbLabel(rx->freq);
+      if(!tunePending)  // チューン待ちの時はチューンと一緒に送る
+        setBfoFreq(rx->bfoFreq);
+      return;
     }
-    setBfoFreq(rx->bfoFreq);
+    ssbLabel(rx->freq);
+  }
+  tunePending = true;
+  tuneService(false);
+}
+
+byte TinySI4732::checkStc() {  // STCINTの確認 INT_PIN未定義時、INT_SOURCEにSTCIENがない時は1ms毎にGET_INT_STATUSを送る
+#ifdef INT_PIN
+  if (INT_SOURCE & STCIEN)
+    return getIntFlags() & STCINT;
+#endif
+  if ((word)millis() == tuneCheck)
+    return intStatus & STCINT;
+  tuneCheck = millis();
+  return readIntStatus() & STCINT;  // INT_PIN定義時もSTCの割り込みがないのでフラグによらず読む
+}
+
+/*
+  チューン完了の待機
+  setFreqからSTCINTまでの時間をチューン所要時間として記録し、TUNE_STATUSをINTACK付きで読んで
+  STCINTをクリアする。非同期のチューンはキューで待った時間を含む。
+  STC_TIMEOUTを超えたらSI4732_ERR_STCにして、その時点のTUNE_STATUSを返す。
+*/
+byte TinySI4732::tuneAndWait(word freq, tTuneStatus &status) {  // チューンして完了を待つ
+  tunePending = false;
+  setFreq(freq);
+  while (!tuneDone(status))
+    ;
+  return status.STATUS;
+}
+
+void TinySI4732::tuneAsync(word freq) {  // 非同期でチューンする。完了はtuneDone()で確認
+  tunePending = false;
+  async = true;
+  setFreq(freq);
+  async = false;
+}
+
+bool TinySI4732::tuneDone(tTuneStatus &status) {  // チューン完了時に1回だけtrueを返す
+  if (!tuneWait || queueCount)
+    return false;
+  unsigned long elapsed = micros() - tuneStartTime;
+  bool timeout = elapsed >= STC_TIMEOUT * 1000UL;
+  if (!timeout) {
+    if (!checkStc())
+      return false;
+  } else {
+    lastError = SI4732_ERR_STC;
+  }
+  tuneWait = false;
+  tuneLatency = elapsed;
+  tuneStatus(0x01, status);  // INTACK
+  if (antCapAuto && !timeout && !(status.STATUS & 0x40))  // 自動選択の結果を学習する
+    learnAntCap(status.FREQ, status.ANTCAP);
+  antCapAuto = false;
+  return true;
+}
+
+unsigned long TinySI4732::getTuneTime() {
+  return tuneLatency;
+}
+
+/*
+  ANTCAPの学習
+  AMのANTCAP自動選択はチューン毎に容量を探すので、指定時の倍の時間がかかる。
+  自動選択で完了したチューンのANTCAPを周波数順のテーブルに記録し、次からは学習値を指定してチューンする。
+  アンテナとANTCAPはLC共振なので容量は1/f^2に比例し、ANTCAPは1/f^2の1次式になる。前後の2点
+  (片側しかなければ近い2点)から1/f^2で補間し、2点と周波数を含む範囲が周波数の1/ANTCAP_SPAN以内の時だけ使う。
+  使えない時は自動選択して新しい点を学習する。満杯時は点の間隔が最も狭い所の1点を外す。
+*/
+word TinySI4732::getAntCap(word freq) {  // 学習値 0:未学習
+  byte i = 0;
+  while (i < antCapCount && antCapTable[i].freq < freq)
+    ++i;
+  if (i < antCapCount && antCapTable[i].freq == freq)
+    return antCapTable[i].antCap;
+  if (antCapCount < 2)
+    return 0;
+  if (i == 0)
+    i = 1;
+  else if (i == antCapCount)
+    --i;
+  const tAntCap &lo = antCapTable[i - 1], &hi = antCapTable[i];
+  word bottom = lo.freq < freq ? lo.freq : freq;
+  word top = hi.freq > freq ? hi.freq : freq;
+  if (top - bottom > freq / ANTCAP_SPAN)
+    return 0;
+  // w = (1/f^2 - 1/lo^2) / (1/hi^2 - 1/lo^2) = (lo-f)/(lo-hi) * (lo+f)/(lo+hi) * (hi/f)^2 (Q12)
+  long w = (((long)lo.freq - (long)freq) << 12) / ((long)lo.freq - (long)hi.freq);  // AVRのintは16ビットなので引く前にlongにする
+  w = w * ((((long)lo.freq + freq) << 12) / ((long)lo.freq + hi.freq)) >> 12;
+  long r = ((long)hi.freq << 12) / freq;
+  w = (w * r >> 12) * r >> 12;
+  long cap = lo.antCap + (((long)hi.antCap - lo.antCap) * w >> 12);
+  return constrain(cap, 1, 6143);
+}
+
+void TinySI4732::learnAntCap(word freq, word antCap) {
+  if (!freq || !antCap || antCap > 6143)
+    return;
+  byte i = 0;
+  while (i < antCapCount && antCapTable[i].freq < freq)
+    ++i;
+  if (i < antCapCount && antCapTable[i].freq == freq) {  // 同じ周波数は更新
+    antCapTable[i].antCap = antCap;
+    return;
+  }
+  if (antCapCount >= ANTCAP_TABLE_SIZE) {  // 前後の間隔が周波数比で最も狭い点を外す(両端は残す)
+    byte drop = 1;
+    for (byte j = 2; j + 1 < antCapCount; ++j) {
+      long gap = antCapTable[j + 1].freq - antCapTable[j - 1].freq;
+      long dropGap = antCapTable[drop + 1].freq - antCapTable[drop - 1].freq;
+      if (gap * antCapTable[drop].freq < dropGap * antCapTable[j].freq)
+        drop = j;
+    }
+    --antCapCount;
+    memmove(&antCapTable[drop], &antCapTable[drop + 1], (antCapCount - drop) * sizeof(tAntCap));
+    if (drop < i)
+      --i;
+  }
+  memmove(&antCapTable[i + 1], &antCapTable[i], (antCapCount - i) * sizeof(tAntCap));
+  antCapTable[i].freq = freq;
+  antCapTable[i].antCap = antCap;
+  ++antCapCount;
+}
+
+const tAntCap *TinySI4732::getAntCapTable(byte &size) {
+  size = antCapCount;
+  return antCapTable;
+}
+
+void TinySI4732::setAntCapTable(const tAntCap *table, byte size) {  // EEPROMの値は整列と範囲確認をして取り込む
+  antCapCount = 0;
+  for (byte i = 0; i < size && i < ANTCAP_TABLE_SIZE; ++i)
+    learnAntCap(table[i].freq, table[i].antCap);
+}
+
+/*
+  エンコーダの加速
+  クリック間隔からACCEL_10X, ACCEL_100X未満の速さの段を求め、ACCEL_HOLD回続いたら1段上げる。
+  間隔が今の段の閾値の2倍を超えたら測った段まで下げる(ヒステリシス)。回転方向が変わったら1倍に戻す。
+  1クリックの周波数はFM, AMがstepFreq、SSBがSSB_STEP。
+*/
+void TinySI4732::addFreqAccel(char count) {
+  if (!count)
+    return;
+  word interval = (word)millis() - accelTime;
+  accelTime = millis();
+  char dir = count > 0 ? 1 : -1;
+  byte speed = interval < ACCEL_100X ? 2 : interval < ACCEL_10X ? 1 : 0;  // 今のクリック間隔の段
+  if (dir != accelDir) {
+    accelDir = dir;
+    accelLevel = accelCount = 0;
+  } else if (speed > accelLevel) {
+    if (++accelCount >= ACCEL_HOLD) {
+      ++accelLevel;
+      accelCount = 0;
+    }
+  } else {
+    accelCount = 0;
+    if (accelLevel && interval >= (accelLevel == 2 ? ACCEL_100X : ACCEL_10X) * 2)
+      accelLevel = speed;
   }
+  if (accelLevel > accelMax[mode])
+    accelLevel = accelMax[mode];
+  int step = (mode < LSB ? rx->stepFreq : SSB_STEP) * (int[]){ 1, 10, 100 }[accelLevel];
+  addFreq(step * count);
+}
+
+void TinySI4732::setAccel(byte mode, byte maxLevel) {
+  if (mode <= USB)
+    accelMax[mode] = maxLevel < 2 ? maxLevel : 2;
+}
+
+byte TinySI4732::getAccel() {
+  return accelLevel;
+}
+
+/*
+  チューンのまとめ
+  エンコーダを速く回すとaddFreqが2ms毎に呼ばれ、前回のチューンが終わる前に次のTUNEが出る。
+  addFreqは目標周波数と表示だけを更新し、チューンは前回のSTCかTUNE_INTERVAL経過後に
+  最新の周波数で1回だけ出力する。途中の周波数は捨てる。addFreqからはすぐに送信し、
+  保留したチューンはpoll()から非同期で送信する。
+  STCはINT_PIN定義時は割り込み、未定義時はSTATUSを1ms毎に読んで確認する。
+*/
+void TinySI4732::tuneService(bool queued) {  // 保留中のチューンの出力 queued:非同期で出力
+  if (!tunePending || queueCount)
+    return;
+  if ((word)millis() - tuneTime < TUNE_INTERVAL && tuneWait && !checkStc())
+    return;  // 前回のチューン中
+  tunePending = false;
+  async = queued;
+  if (mode >= LSB)
+    setBfoFreq(rx->bfoFreq);
   setFreq(rx->freq);
+  async = false;
 }
 
 byte TinySI4732::getIntStatus(){
@@ -272,9 +980,13 @@ byte TinySI4732::getIntStatus(){
 }
 
 byte TinySI4732::getTuneStatus(bool cancel, tTuneStatus &status) {
+  return tuneStatus(cancel ? 0x02 : 0, status);
+}
+
+byte TinySI4732::tuneStatus(byte arg, tTuneStatus &status) {  // arg bit1:CANCEL, bit0:INTACK
   byte cmd[] = {
     FM_TUNE_STATUS,
-    (byte)(cancel ? 2 : 0)
+    arg
   };
   if (mode == FM) {
     //
@@ -284,6 +996,8 @@ byte TinySI4732::getTuneStatus(bool cancel, tTuneStatus &status) {
     cmd[0] = SSB_TUNE_STATUS;
   }
   byte cmdStatus = commandOut(cmd, status);
+  if (arg & 0x01)
+    intStatus &= ~STCINT;
   status.FREQ = (status.FREQ << 8) | (status.FREQ >> 8);
   status.ANTCAP = (status.ANTCAP << 8) | (status.ANTCAP >> 8);
   return cmdStatus;
@@ -303,7 +1017,10 @@ byte TinySI4732::seekStart(bool seekup) {
   }
   intervalTime = millis();
   seek = true;
-  return commandOut(cmd);
+  tuneWait = false;  // STCはseekNowで扱う
+  byte status = commandOut(cmd);
+  intStatus &= ~STCINT;  // 前回のチューン完了はSEEK_STARTでクリアされる
+  return status;
 }
 
 bool TinySI4732::seekNow(bool cancel){
@@ -316,9 +1033,15 @@ bool TinySI4732::seekNow(bool cancel){
     getTuneStatus(cancel, status);
     delay(80);
   }
-  if((word)millis() - intervalTime > 100 || cancel){
+#ifdef INT_PIN
+  bool done = getIntFlags() & STCINT;  // STCINTの割り込みがあれば待たずに完了処理
+#else
+  bool done = false;
+#endif
+  if((word)millis() - intervalTime > 100 || cancel || done){
     intervalTime += 100;
-    if(getTuneStatus(cancel, status) & 1){  // シーク完了
+    byte arg = (cancel ? 0x02 : 0) | (done ? 0x01 : 0);  // 完了時はINTACK
+    if((tuneStatus(arg, status) & 1) || done){  // シーク完了
       setFreq(status.FREQ, 0);
       //updateRsqStatus();
       seek = false;
@@ -360,9 +1083,83 @@ byte TinySI4732::getRsqStatus(tRsqStatus &rsqStatus) {
   } else {
     cmd[0] = SSB_RSQ_STATUS;
   }
+#ifdef INT_PIN
+  cmd[1] = 0x01;  // INTACK
+  byte status = commandOut(cmd, rsqStatus);
+  intStatus &= ~RSQINT;
+  if (INT_SOURCE & RSQIEN) {  // 今のRSSIを中心に閾値を置き直す
+    word property = rsqProperty();
+    setProperty(property + 3, constrain(rsqStatus.RSSI + RSQ_WINDOW, 0, 127));  // RSSI_HI_THRESHOLD
+    setProperty(property + 4, constrain(rsqStatus.RSSI - RSQ_WINDOW, 0, 127));  // RSSI_LO_THRESHOLD
+  }
+  return status;
+#else
   return commandOut(cmd, rsqStatus);
+#endif
+}
+
+byte TinySI4732::getRdsStatus(tRdsStatus &rdsStatus) {
+  if (mode != FM)
+    return 0b11000000;  // ERROR
+  byte status = commandOut((const byte[]){ FM_RDS_STATUS, 0x01 }, rdsStatus);  // INTACK
+  intStatus &= ~RDSINT;
+  rdsStatus.BLOCKA = (rdsStatus.BLOCKA << 8) | (rdsStatus.BLOCKA >> 8);
+  rdsStatus.BLOCKB = (rdsStatus.BLOCKB << 8) | (rdsStatus.BLOCKB >> 8);
+  rdsStatus.BLOCKC = (rdsStatus.BLOCKC << 8) | (rdsStatus.BLOCKC >> 8);
+  rdsStatus.BLOCKD = (rdsStatus.BLOCKD << 8) | (rdsStatus.BLOCKD >> 8);
+  return status;
+}
+
+/*
+  割り込み
+  STATUSのSTCINT, RSQINT, RDSINTはGET_INT_STATUS等のコマンドの応答でだけ更新され、
+  STATUSを読むだけでは変わらない。INT_PIN定義時はGPO2/INTの立下りで割り込みフラグだけを
+  立て、フラグがある時にGET_INT_STATUSを送る。割り込みがなければバスを使わない。
+  INT_PIN未定義時は呼出し毎にGET_INT_STATUSを送る。非同期コマンドの実行中は送らずに前回の値を返す。
+  各ビットはgetTuneStatus(シーク完了時), getRsqStatus, getRdsStatusでクリアされる。
+*/
+byte TinySI4732::getIntFlags() {  // 未処理の割り込み要因 STCINT, RSQINT, RDSINT
+#ifdef INT_PIN
+  if (!intFlag || queueCount)
+    return intStatus;
+  intFlag = false;  // 読込み中の割り込みを取りこぼさないよう先に落とす
+#endif
+  return readIntStatus();
+}
+
+byte TinySI4732::readIntStatus() {  // GET_INT_STATUSで割り込み要因を読む
+  if (queueCount)
+    return intStatus;  // 非同期コマンドの実行中は送れない
+  // commandOutはpoll()から保留中のチューンを出すことがあるので直接送る
+  return intStatus = sendCommand((const byte[]){ GET_INT_STATUS }, 1) & (STCINT | RDSINT | RSQINT);
+}
+
+#ifdef INT_PIN
+void TinySI4732::intHandler() {  // INTピンの割り込み処理
+  intFlag = true;
+}
+
+word TinySI4732::rsqProperty() {  // RSQ割り込みのプロパティ番号 +3:RSSI_HI, +4:RSSI_LO
+  return mode == FM ? FM_RSQ_INT_SOURCE : mode == AM ? AM_RSQ_INTERRUPTS : SSB_RSQ_INTERRUPTS;
 }
 
+void TinySI4732::setupInt() {  // POWER_UP後の割り込み設定
+  intStatus = 0;
+  setProperty(GPO_IEN, INT_SOURCE);
+  if (INT_SOURCE & RSQIEN) {  // RSSIの上下限で割り込む。閾値0で起動直後に1回読ませる
+    word property = rsqProperty();
+    setProperty(property + 3, 0);
+    setProperty(property + 4, 0);
+    setProperty(property, 0b00000011);  // RSSIHIEN, RSSILIEN
+  }
+  if ((INT_SOURCE & RDSIEN) && mode == FM) {
+    setProperty(FM_RDS_INT_SOURCE, 0x0001);    // RDSRECV
+    setProperty(FM_RDS_INT_FIFO_COUNT, 1);
+    setProperty(FM_RDS_CONFIG, 0x0001);        // RDSEN
+  }
+}
+#endif
+
 byte TinySI4732::setFilter(byte filter) {
   if (mode == FM) {
     rx->fmAmFilter = filter = filter > 4 ? 4 : filter;
@@ -415,7 +1212,13 @@ byte TinySI4732::setAgcGain(bool agcOn, byte gain) {
   } else {
     sprintf(radioLabel[L_AGC], "%d", gain);
   }
-  return commandOut(cmd);
+  if (!memcmp(cmd, agcCmd, sizeof(cmd)))
+    return 0x80;  // 設定済みなので送信しない
+  byte status = commandOut(cmd);
+  memcpy(agcCmd, cmd, sizeof(cmd));
+  if (status & 0x40)
+    agcCmd[0] = 0;  // 失敗時は次回送り直す
+  return status;
 }
 
 byte TinySI4732::getAgcGainSize() {
@@ -447,73 +1250,252 @@ char *TinySI4732::getLabel(tLabelname labelNo) {
   return radioLabel[labelNo];
 }
 
-#ifdef FLASHROMPATCH
-bool TinySI4732::patchFlashRomLoad() {
-  commandOut((const byte[]){ POWER_UP, 0b00110001, 0b00000101 });  // patch
-
-  byte buf[8];
-  byte count = 0;
-  const byte *patchArgsAddr = patchArgs;
-  const byte *patchDataAddr = patchData;
-  for(word addr = 0; addr < sizeof(patchData); addr += 7){
-    if(count && --count){
-      buf[0] = 0x16;  // PATCH DATA
-    }else{
-      buf[0] = 0x15;  // PATCH ARGS
-      count = pgm_read_byte(patchArgsAddr++);
-    }
-    for(byte i = 1; i < 8; ++i)
-      buf[i] = pgm_read_byte(patchDataAddr++);
-
-    Wire.beginTransmission(SI4732_ADDR);
-    Wire.write(buf, 8);
-    Wire.endTransmission();
-
-    delayMicroseconds(300);  // tCTS 200us=739ms, 300us=851ms
-    Wire.requestFrom(SI4732_ADDR, 1);
-    if (Wire.read() & 0x040)
-      return false;  // ERROR
+/*
+  パッチのダウンロード
+  patchBegin()でPATCHビット付きのPOWER_UPを送り、patchStep(n)でn個ずつレコードを送る。
+  patchStepは進捗(%)を返すので、送信の合間にLCD表示や入力の処理ができる。
+  最後のレコードの適用待ち(10ms)はブロックせず、経過するまで99を返す。進捗の表示だけならgetPatchProgress()を使う。
+  エラー時はチップをリセット(キューとシャドウも破棄)してPATCH_ERRORを返し、次のsetRadioで電源から入れ直す。
+  setRadioAsyncはPOWER_UPとパッチの目印(PATCH_ARGS)をキューに入れ、poll()が1回にPATCH_STEP個ずつ送る。
+  patchFlashRomLoad, patchExtEepRomLoadは最後まで送る同期版。
+  レコードを送った後、チップの処理中(CTS=0)に次のレコードを読むので、外部EEPROMの読込み時間がCTS待ちに隠れる。
+  先読みしたレコードはpatchStepの呼出しをまたいで持ち越し、外部EEPROMは先頭以外アドレスを送らずに続きから読む。
+  ダウンロード中は外部EEPROMに他からアクセスしないこと。
+*/
+bool TinySI4732::patchBegin(word startAddr) {
+  while (poll());  // 非同期コマンドを掃き出してから実行
+  if (sendCommand(patchPowerUp, sizeof(patchPowerUp)) & 0x40) {  // patch
+    patchError();
+    return false;
+  }
+  if (!patchStart(startAddr)) {
+    patchError();
+    lastError = SI4732_ERR_PATCH;
+    return false;
   }
-  delay(10);
   return true;
 }
-#else
 
-bool TinySI4732::patchExtEepRomLoad(word startAddr) {
-  byte buf[32];
+byte TinySI4732::patchStep(byte records) {  // 最後のレコードの適用待ち(10ms)は待たずに99を返す
+  word pos = patchPos;
+  byte progress = patchSend(records);
+  if (progress != 100 || !patchSize)
+    return progress;  // 送信中、エラー、ダウンロードなし
+  if (pos != patchPos)
+    patchTime = micros();  // 最後のレコードを送った
+  if (micros() - patchTime < 10000)
+    return patchProgress = 99;
+  patchSize = patchPos = 0;  // 適用済み
+  return patchProgress;
+}
 
-  Wire.beginTransmission(EEPROM_ADDR);  // eepromのリードアドレスをセット
-  Wire.write(startAddr >> 8);
-  Wire.write(startAddr);
-  Wire.endTransmission();
+byte TinySI4732::getPatchProgress() {
+  return patchProgress;
+}
 
-  Wire.requestFrom(EEPROM_ADDR, 32);  // headerの読込
-  for (byte i = 0; i < 32; ++i) {
-    while (Wire.available() <= 0);
-    buf[i] = Wire.read();
+byte TinySI4732::patchSend(byte records) {  // records個送る。最後の適用待ちはしない
+  byte buf[8];  // 送るレコード
+  for ( ; records && patchPos < patchSize; --records) {
+    if (patchAhead)  // 前のレコードのCTS待ちの間に読んである(前回の呼出しの分も含む)
+      memcpy(buf, patchNext, sizeof(buf));
+    else if (!patchRead(buf, 1, patchPos, !patchPos))  // 先頭だけアドレスを合わせる
+      return patchError();
+    patchAhead = false;
+    if (patchPos == patchSize - 1 && patchCrcRef && ~patchCrc != patchCrcRef) {  // 最後のレコードの前に確認
+      patchError();
+      lastError = SI4732_ERR_PATCH;
+      return PATCH_ERROR;
+    }
+    if (!patchRecord(buf, patchPos < patchSize - 1 ? patchNext : NULL))
+      return patchError();
+    patchAhead = patchPos < patchSize;
   }
-  word dataSize = (buf[31] << 8) + buf[30];  // ptach data size
+  if (patchProgress != PATCH_ERROR && patchSize)  // patchSize=0:patchStart前(0)、ダウンロードなし(100)のまま
+    patchProgress = (unsigned long)patchPos * 100 / patchSize;
+  return patchProgress;
+}
 
-  commandOut((const byte[]){ POWER_UP, 0b00110001, 0b00000101 });  // patch
+void TinySI4732::patchAbort() {
+  reset();
+  patchSize = patchPos = 0;
+  patchAhead = false;
+  patchProgress = PATCH_ERROR;
+}
 
-  for (word addr = 0; addr < dataSize; addr += 32) {
-    Wire.requestFrom(EEPROM_ADDR, 32);
-    for (byte i = 0; i < 32; ++i) {
-      buf[i] = Wire.read();
+byte TinySI4732::patchRead(byte *buf, byte records, word pos, bool seek) {  // posから読む 戻り値 読んだレコード数 0:エラー
+  byte n = patchSize - pos < 4 ? patchSize - pos : 4;  // 32バイトまで
+  n = n < records ? n : records;
+#ifdef FLASHROMPATCH
+  (void)seek;
+  for (byte i = 0; i < n * 8; i += 8) {
+    if (patchCount && --patchCount) {
+      buf[i] = PATCH_DATA;
+    } else {
+      buf[i] = PATCH_ARGS;
+      patchCount = pgm_read_byte(&patchArgs[patchArg++]);
+    }
+    for (byte j = 1; j < 8; ++j)
+      buf[i + j] = patchByte();
+  }
+#else
+  // seek:posにアドレスを合わせる。合わせなければEEPROMのアドレスカウンタの続きから読む
+  // 読込みが途中で切れるとアドレスカウンタが進んでいるので、busReadの再送は使わずアドレスから合わせ直す
+  word addr = patchAddr + pos * 8;
+  for (byte retry = 0; ; ++retry) {
+    if (seek || retry) {
+      const byte eepAddr[] = { highByte(addr), lowByte(addr) };
+      if (busWrite(EEPROM_ADDR, eepAddr, sizeof(eepAddr)))
+        return 0;
+    }
+#ifdef STATS
+    statRead += n * 8;
+#endif
+    if (Bus::read(EEPROM_ADDR, buf, n * 8) == n * 8)
+      break;
+    if (retry >= I2C_RETRY) {
+      lastError = SI4732_ERR_I2C;
+      return 0;
     }
+    if (retry)
+      Bus::clear();
+    delayMicroseconds(100 << retry);  // バックオフ
+  }
+#endif
+  patchCrc = crc32(patchCrc, buf, n * 8);
+  return n;
+}
 
-    for (word addrStep = addr; addrStep < addr + 32 && addrStep < dataSize; addrStep += 8) {
-      Wire.beginTransmission(SI4732_ADDR);
-      Wire.write(&buf[addrStep - addr], 8);
-      Wire.endTransmission();
+/*
+  パッチのCRC32の確認
+  外部EEPROMはヘッダのpatch_crc(Si4732_eepromが書く)、FLASHはpatch.hのPATCH_CRCと比べる。
+  ダウンロード中は最後のレコードを送る前に確認し、一致しなければ送らずにリセットするのでパッチは適用されない。
+  patchCheckはチップに送らずに読むだけなので、壊れたパッチをダウンロード前に見つけられる。
+  patch_crcが0(CRC対応前のSi4732_eepromで書いた)の時は確認しない。
+*/
+bool TinySI4732::patchCheck(word startAddr) {
+  while (poll());  // 非同期のダウンロードを終わらせてから実行
+  bool ok = patchStart(startAddr);
+  while (ok && patchPos < patchSize) {
+    byte buf[32];
+    byte n = patchRead(buf, 4, patchPos, !patchPos);
+    patchPos += n;
+    ok = n;
+  }
+  if (ok && patchCrcRef && ~patchCrc != patchCrcRef)
+    ok = false;
+  if (!ok)
+    lastError = SI4732_ERR_PATCH;
+  patchSize = patchPos = 0;
+  patchProgress = 100;
+  return ok;
+}
 
-      delayMicroseconds(300);  // tCTS
-      Wire.requestFrom(SI4732_ADDR, 1);
-      if (Wire.read() & 0x40)
-        return false;  // ERROR
+bool TinySI4732::patchStart(word startAddr) {  // 送信位置の初期化 戻り値 false:外部EEPROMにパッチがない
+  patchPos = 0;
+  patchProgress = 0;
+  patchCrc = 0xFFFFFFFF;
+  patchAhead = false;
+#ifdef FLASHROMPATCH
+  (void)startAddr;
+  patchArg = patchCount = 0;
+  patchIndex = patchZero = 0;
+  patchSize = PATCH_RECORDS;
+  patchCrcRef = PATCH_CRC;
+#else
+  byte buf[32];
+  word size = 0;
+  if (startAddr != PATCH_AUTO) {
+    size = patchHeader(startAddr, buf);
+    patchCrcRef = patchHeaderCrc(buf);
+  } else {  // EEPROM_PATCH_IDのパッチ、なければ最初に見つかったパッチ
+    for (byte i = 0; i < sizeof(patchSlots) / sizeof(patchSlots[0]); ++i) {
+      word n = patchHeader(patchSlots[i], buf);
+      if (n && (!size || !strncmp((const char *)&buf[16], EEPROM_PATCH_ID, sizeof(EEPROM_PATCH_ID) - 1))) {
+        startAddr = patchSlots[i];
+        size = n;
+        patchCrcRef = patchHeaderCrc(buf);
+      }
     }
   }
-  delay(10);
+  if (!size)
+    return false;
+  patchSize = size / 8;
+  patchAddr = startAddr + 32;
+#endif
+  return true;
+}
+
+bool TinySI4732::patchRecord(const byte *record, byte *next) {  // 1レコード送信 戻り値 false:エラー
+#ifdef STATS
+  unsigned long startTime = micros();
+  statMark();
+#endif
+  if (busWrite(i2cAddr, record, 8))
+    return false;  // ERROR
+  if (next && !patchRead(next, 1, patchPos + 1, false))  // チップの処理中(CTS=0)に次のレコードを読む
+    return false;
+  byte status = waitCts(record[0]);  // CTSが立つまでSTATUSを読む。固定の300us待ちは1105レコードで851ms
+#ifdef STATS
+  countStats(record[0], micros() - startTime);
+#endif
+  if ((status & 0xC0) != 0x80)
+    return false;  // CTSタイムアウト, ERR
+  ++patchPos;
   return true;
 }
+
+#ifdef FLASHROMPATCH
+byte TinySI4732::patchByte() {  // PATCH_ESC,n:0がn個 PATCH_ESC,0:PATCH_ESC自身
+  if (patchZero) {
+    --patchZero;
+    return 0;
+  }
+  byte data = pgm_read_byte(&patchData[patchIndex++]);
+  if (data != PATCH_ESC)
+    return data;
+  patchZero = pgm_read_byte(&patchData[patchIndex++]);
+  if (!patchZero)
+    return PATCH_ESC;
+  --patchZero;
+  return 0;
+}
+#endif
+
+#ifndef FLASHROMPATCH
+word TinySI4732::patchHeader(word addr, byte *header) {  // 戻り値 パッチのバイト数 0:読めない, パッチのヘッダでない
+  const byte eepAddr[] = { highByte(addr), lowByte(addr) };
+  if (busWrite(EEPROM_ADDR, eepAddr, sizeof(eepAddr)) ||  // eepromのリードアドレスをセット
+      busRead(EEPROM_ADDR, header, 32) != 32)             // headerの読込
+    return 0;
+  word size = (header[31] << 8) + header[30];  // patch_size
+  if (strncmp((const char *)&header[16], "patch-", 6) ||  // patch_id
+      (size & 7) || addr > EEPROM_SIZE - 32 || size > EEPROM_SIZE - 32 - addr)  // 未書込み(0xFF)は除く
+    return 0;
+  return size;
+}
+#endif
+
+byte TinySI4732::patchError() {  // 途中まで送ったチップは使えないのでリセットする
+  patchAbort();
+  return PATCH_ERROR;
+}
+
+#ifdef FLASHROMPATCH
+bool TinySI4732::patchFlashRomLoad() {
+  if (!patchBegin())
+    return false;
+  byte progress;
+  while ((progress = patchStep(255)) < 100)
+    ;
+  return progress == 100;
+}
+#else
+bool TinySI4732::patchExtEepRomLoad(word startAddr) {
+  if (!patchBegin(startAddr))
+    return false;
+  byte progress;
+  while ((progress = patchStep(255)) < 100)
+    ;
+  return progress == 100;
+}
 #endif
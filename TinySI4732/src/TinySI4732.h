@@ -1,6 +1,47 @@
 #pragma once
-//#define DEBUG // コマンド入出力をシリアル出力
-#include "patch.h"  // patchをFlashROMから読み込む。コメント時は外部EEPROMから読み込む。
+//#define TRACE // コマンドの送受信をリングバッファに記録する。コメント時は記録コードを生成しない
+#define TRACE_SIZE  16  // トレースの記録数
+//#define STATS // オペコード毎の統計を取る
+#define STATS_SIZE  12  // 統計を取るオペコードの数
+#define CTSPOLLING  // CTSをポーリングして待つ。コメント時は固定時間(tCTS)待つ。
+#define CMDQUEUE_SIZE 16  // 非同期コマンドキューの段数
+#define PROPERTY_CACHE_SIZE 20  // プロパティシャドウの登録数
+//#define INT_PIN 0 // SI4732のGPO2/INTを接続したピン(外部割り込み可能なピン)。コメント時は割り込みを使わない
+#define INT_SOURCE  (STCIEN | RSQIEN) // INT_PIN使用時に有効にする割り込み STCIEN, RSQIEN, RDSIEN
+#define RSQ_WINDOW  3   // RSQ割り込みのRSSI変化幅(dBuV) 前回値からこれ以上変化したら割り込む
+#define STC_TIMEOUT 1000  // tuneAndWait, tuneDoneのチューン完了待ちのタイムアウト(ms)
+#define TUNE_INTERVAL 100 // addFreqのチューンをまとめる時間(ms) 前回のチューン完了(STC)かこの時間で次を出力する
+#define BFO_WINDOW  1000  // SSBのaddFreqでBFOだけで動かす範囲(±Hz 最大16383) 超えたらチューンし直す
+#define SSB_STEP    100 // addFreqAccelのSSBの1クリックの周波数(Hz) FM, AMはtRadio::stepFreq
+#define ACCEL_10X   50  // addFreqAccelのクリック間隔(ms)がこれ未満なら10倍
+#define ACCEL_100X  20  // クリック間隔(ms)がこれ未満なら100倍
+#define ACCEL_HOLD  4   // 加速を1段上げるのに必要な連続クリック数。下げるのは間隔が閾値の2倍を超えた時
+#define ANTCAP_TABLE_SIZE 16  // AM, SSBのANTCAP学習テーブルの点数(1点4バイト)
+#define ANTCAP_SPAN 8   // 学習点2点と周波数を含む範囲が周波数の1/ANTCAP_SPAN以内なら補間する
+#define PATCH_STEP  4   // setRadioAsyncでpoll()1回に送るパッチのレコード数(1レコード約0.6ms)
+#define AM_ON_PATCH // SSBパッチ適用中はAMもパッチのまま受信し、AM⇔SSBの切替でパッチを読み直さない。コメント時はAMで電源を入れ直す
+#define EEPROM_PATCH_ID "patch-init" // 外部EEPROMから読むパッチのID "patch-init", "patch-full" なければもう一方を読む
+#ifndef EXTEEPROMPATCH  // ホストのベンチマークで外部EEPROMを選ぶ時に-DEXTEEPROMPATCHを付ける
+#include "patch.h"  // patchをFlashROMから読み込む。コメント時は外部EEPROMから読み込む。extras/host/patchgen.cppで生成した圧縮形式
+#endif
+#include "TinySI4732Bus.h"
+#ifndef SI4732_BUS
+#ifdef ARDUINO
+#define SI4732_BUS  WireBus // I2Cトランスポート WireBus, tWireBus<Wire1, SDA1, SCL1>, tSoftBus<SDA, SCL>
+#else
+#define SI4732_BUS  MockBus // ホスト(Linux)用
+#endif
+#endif
+#define SI4732_ADDR 0x11    // SENピン LOW:0x11, HIGH:0x63
+
+#define SI4732_OK         0 // getError()の戻り値 エラーなし
+#define SI4732_ERR_I2C    1 // I2C通信エラー(再送後も失敗)
+#define SI4732_ERR_CTS    2 // CTSタイムアウト
+#define SI4732_ERR_STATUS 3 // STATUSのERRビット
+#define SI4732_ERR_STC    4 // チューン完了(STC)タイムアウト
+#define SI4732_ERR_PATCH  5 // パッチのCRC32不一致、外部EEPROMにパッチがない
+#define PATCH_ERROR       0xFF  // patchStep()の戻り値 エラーで中止した
+#define PATCH_AUTO        0xFFFF  // patchBegin()のstartAddr 外部EEPROMのヘッダからEEPROM_PATCH_IDのパッチを探す
 
 #define FM  0
 #define AM  1
@@ -12,6 +53,8 @@
 #define SET_PROPERTY    0x12  // Sets the value of a property. 
 #define GET_PROPERTY    0x13  // Retrieves a property’s value. 
 #define GET_INT_STATUS  0x14  // Reads interrupt status bits. 
+#define PATCH_ARGS      0x15  // Patch argument.
+#define PATCH_DATA      0x16  // Patch data.
 #define SSB_TUNE_FREQ   0x40  // Selects the SSB tuning frequency. 
 #define SSB_TUNE_STATUS 0x42  // Queries the status of previous SSB_TUNE_FREQ 
 #define SSB_RSQ_STATUS  0x43  // Queries the status of the Received Signal Quality (RSQ) of the current channel 
@@ -33,10 +76,21 @@
 #define FM_AGC_STATUS   0x27  // Queries the current AGC settings All
 #define FM_AGC_OVERRIDE 0x28  // Override AGC setting by disabling and forcing it to a fixed value All
 
+#define STCINT  0x01  // STATUS シーク/チューン完了割り込み
+#define RDSINT  0x04  // STATUS RDS割り込み
+#define RSQINT  0x08  // STATUS 信号品質割り込み
+#define STCIEN  0x01  // GPO_IEN シーク/チューン完了割り込み許可
+#define RDSIEN  0x04  // GPO_IEN RDS割り込み許可
+#define RSQIEN  0x08  // GPO_IEN 信号品質割り込み許可
+
+#define GPO_IEN                         0x0001
 #define AM_CHANNEL_FILTER               0x3102 
 #define SSB_BFO                         0x0100 
 #define SSB_MODE                        0x0101  
 #define FM_DEEMPHASIS                   0x1100 
+#define FM_RSQ_INT_SOURCE               0x1200
+#define FM_RSQ_RSSI_HI_THRESHOLD        0x1203
+#define FM_RSQ_RSSI_LO_THRESHOLD        0x1204
 #define FM_CHANNEL_FILTER               0x1102
 #define FM_SEEK_BAND_BOTTOM             0x1400 
 #define FM_SEEK_BAND_TOP                0x1401 
@@ -45,6 +99,15 @@
 #define FM_BLEND_RSSI_MONO_THRESHOLD    0x1801 
 #define FM_BLEND_SNR_STEREO_THRESHOLD   0x1804 
 #define FM_BLEND_SNR_MONO_THRESHOLD     0x1805 
+#define FM_RDS_INT_SOURCE               0x1500
+#define FM_RDS_INT_FIFO_COUNT           0x1501
+#define FM_RDS_CONFIG                   0x1502
+#define AM_RSQ_INTERRUPTS               0x3200
+#define AM_RSQ_RSSI_HIGH_THRESHOLD      0x3203
+#define AM_RSQ_RSSI_LOW_THRESHOLD       0x3204
+#define SSB_RSQ_INTERRUPTS              0x3300
+#define SSB_RSQ_RSSI_HI_THRESHOLD       0x3303
+#define SSB_RSQ_RSSI_LO_THRESHOLD       0x3304
 #define AM_SEEK_BAND_BOTTOM             0x3400 
 #define AM_SEEK_BAND_TOP                0x3401 
 #define AM_SEEK_FREQ_SPACING            0x3402 
@@ -79,6 +142,17 @@ struct tRsqStatus{
   byte MULT;        // FM only
   byte FREQOFF;     // FM only
 };
+struct tRdsStatus{
+  byte STATUS;      //
+  byte RESP1;       // RDS割り込み要因
+  byte RESP2;       // 同期状態
+  byte FIFOUSED;    // FIFOに残っているグループ数
+  word BLOCKA;      //
+  word BLOCKB;      //
+  word BLOCKC;      //
+  word BLOCKD;      //
+  byte BLE;         // ブロックエラー
+};
 struct tAgcStatus{
   byte STATUS;      //
   byte RESP1;       //
@@ -88,8 +162,8 @@ struct tAgcStatus{
 struct tRadio{
   byte mode;        // 0:FM, 1:AM, 2:LSB, 3:USB
   word freq;        // 受信周波数 FM:6400~10800MHz, AM:149k~23000kHz, LSB/USB:520k~30000kHz
-  word fmAmAntCap;  // FM:0(auto),1~191, AM:0(auto),1~6143
-  word ssbAntCap;   // LSB/USB:1~6143
+  word fmAmAntCap;  // FM:0(auto),1~191, AM:0(auto 学習値があれば使う),1~6143
+  word ssbAntCap;   // LSB/USB:0(学習値 なければ2300kHz未満はauto, 以上は1),1~6143
   word minFreq;     // シーク下限周波数
   word maxFreq;     // シーク上限周波数
   byte stepFreq;    // 10:FM 100kHz, 1:AM 1kHz, 5:AM 5kHz, 9:AM 9kHz
@@ -99,27 +173,76 @@ struct tRadio{
   byte fmAmFilter;  // FM:0:AUTO 1:110k, 2:84k 3:60k 4:40k
                     // AM:0:6.0k, 1:4.0k, 2:3.0k, 3:2.5kG, 4:2.0k, 5:1.8k, 6:1.0k
   byte ssbFilter;   // LSB/USB:0:4.0k, 1:3.0k, 2:2.2k, 3:1.2k, 4:1.0k, 5:0.5k
-  int  bfoFreq;     // -16383kHz~16383kHz
+  int  bfoFreq;     // -16383Hz~16383Hz
+};
+struct tAntCap{
+  word freq;        // 周波数(kHz)
+  word antCap;      // 自動選択されたANTCAP
+};
+struct tCommand{
+  byte cmd[8];      // コマンド
+  byte cmdSize;     // コマンド長
+  byte *response;   // 応答格納先 nullptr:応答なし
+  byte resSize;     // 応答長(STATUSを含む)
+};
+struct tProperty{
+  word property;    // プロパティ番号
+  word value;       // 設定値
+  bool valid;       // true:設定値が有効
+  word compTime;    // 設定完了時間の最大値(us)
+};
+struct tTrace{
+  byte cmd[6];      // オペコードと引数(先頭6バイト)
+  byte cmdSize;     // コマンド長
+  byte status;      // STATUS
+  byte resSize;     // 応答長(STATUSを含む) 0:応答なし
+  unsigned long startTime;  // 送信開始時刻(us)
+  unsigned long ctsWait;    // CTS待ち時間(us)
+};
+struct tStats{
+  byte opcode;              // オペコード
+  unsigned long count;      // 呼出し回数
+  unsigned long writeBytes; // 書込みバイト数
+  unsigned long readBytes;  // 読込みバイト数(CTSポーリングを含む)
+  unsigned long totalTime;  // 処理時間の累計(us)
+  unsigned long maxTime;    // 処理時間の最大(us)
+  unsigned long ctsWait;    // CTS待ち時間の累計(us)
 };
 enum tLabelname {L_MODE, L_FREQ, L_STEREO, L_FILTER, L_AGC, L_VOLUME, LABEL_SIZE};  // getLabel()での引数
 
 class TinySI4732{
   public:
-  TinySI4732(byte RESET_PIN);
+  TinySI4732(byte RESET_PIN, byte i2cAddr = SI4732_ADDR);
   void reset();
   void setup();
   byte powerUp(byte func);
   byte powerDown();
 
   void setRadio(tRadio *radio);           // rRadioを通して総括的に設定をする
+  void setRadioAsync(tRadio *radio);      // setRadioを非同期で実行する。poll()で処理を進める
   byte getRev(tGetRev &rev);              // チップリビジョンを取得
   byte setFreq(word freq);                // 受信周波数の設定
   byte setFreq(word freq, word antCap);   // 受信周波数とアンテナキャパシタンスの設定
   byte setBfoFreq(int bfoFreq);           // BFOの設定
+  byte tuneAndWait(word freq, tTuneStatus &status);  // チューンして完了(STC)を待ち、結果を返す
+  void tuneAsync(word freq);              // 非同期でチューンする。poll()で送信する
+  bool tuneDone(tTuneStatus &status);     // チューン完了時に1回だけtrueと結果を返す
+  unsigned long getTuneTime();            // 直前のチューンの所要時間(us)
+  byte setFreqHz(uint32_t hz);            // 受信周波数をHzで設定 SSBはキャリアとBFOに分ける
+  uint32_t getFreqHz();                   // 受信周波数(Hz) SSBはBFOを含む
   void addFreq(int addFreq);              // 受信周波数を加算する UNIT FM:0.01MHz, AM:1kHz, SSB:1Hz
+                                          // チューンは前回の完了までまとめ、poll()で出力する
+  void addFreqAccel(char count);          // エンコーダのクリック数で加算する。回転速度で1x/10x/100xに加速
+  void setAccel(byte mode, byte maxLevel);  // モード毎の加速の上限 0:1x, 1:10x, 2:100x
+  byte getAccel();                        // 現在の加速段 0:1x, 1:10x, 2:100x
+  word getAntCap(word freq);              // 学習したANTCAP(AM, SSB) 0:未学習
+  const tAntCap *getAntCapTable(byte &size);  // ANTCAP学習テーブルの取得(EEPROM保存用)
+  void setAntCapTable(const tAntCap *table, byte size);  // 学習テーブルの設定 size=0:消去
   void setStereo(bool stereo);            // FMステレオ受信有無の設定 true:auto stereo, false:mono
   byte getRsqStatus(tRsqStatus &rsqStatus);  // rsqステータスの更新（RSSI、SNR）
   byte getIntStatus();                    // ステータスの取得
+  byte getIntFlags();                     // 未処理の割り込み要因 STCINT, RSQINT, RDSINT
+  byte getRdsStatus(tRdsStatus &rdsStatus);  // RDSの読込み（FMのみ）
   byte seekStart(bool seekup);            // シーク開始（SSBを除く）
   bool seekNow(bool cancel);              // シーク中は定期的に呼び出す。
   byte getTuneStatus(bool cancel, tTuneStatus &status);        // tuneStatusの更新
@@ -138,23 +261,139 @@ class TinySI4732{
   template <typename T1, typename T2> byte commandOut(const T1 &cmd, T2 &response); // コマンド出力
   byte setProperty(word property, word data);   // プロパティ値の設定
   word getProperty(word property);              // プロパティ値の取得
+  unsigned long getCtsWaitTime();               // 直前のコマンドのCTS待ち時間(us)
+  byte getError();                              // 最後のエラー SI4732_OK, SI4732_ERR_xxx。取得後クリア
+  word getPropertyTime(word property);          // プロパティ設定の完了時間(us) 0:未計測
+  const tProperty *getPropertyTable(byte &size);  // プロパティシャドウの取得（診断用）
+  bool submit(const byte *cmd, byte cmdSize, byte *response = nullptr, byte resSize = 0); // 非同期コマンドの登録
+  byte poll();                                  // 非同期コマンドの処理を進める。戻り値:未処理のコマンド数
+  bool busy();                                  // true:非同期コマンド処理中
+  #ifdef STATS
+  const tStats *getStats(byte &size);           // オペコード毎の統計の取得
+  void clearStats();                            // 統計の消去
+  #endif
+  #ifdef TRACE
+  byte getTraceSize();                          // トレースの記録数
+  const tTrace *getTrace(byte n);               // トレースの取得 0:最古
+  void clearTrace();                            // トレースの消去
+  #endif
   #ifdef FLASHROMPATCH
   bool patchFlashRomLoad();   // FLSH ROMからpatchを読み込む
   #else
-  bool patchExtEepRomLoad(word startAddr);  // 外部EEPROMからpatchを読み込む
+  bool patchExtEepRomLoad(word startAddr = PATCH_AUTO);  // 外部EEPROMからpatchを読み込む
   #endif
+  bool patchBegin(word startAddr = PATCH_AUTO);  // パッチのダウンロード開始(POWER_UP) startAddr:外部EEPROMのヘッダのアドレス
+  bool patchCheck(word startAddr = PATCH_AUTO);  // パッチをチップに送らずに読んでCRC32を確認する
+  byte patchStep(byte records);  // パッチをrecords個送る。戻り値:進捗0~100(%), PATCH_ERROR:エラーで中止
+  byte getPatchProgress();       // パッチの進捗0~100(%), PATCH_ERROR:エラーで中止 送信はしない
+  void patchAbort();             // パッチのダウンロードを中止してチップをリセットする(キューも破棄)
 
 //  tRsqStatus rsqStatus;     //
 
   private:
   byte RESET_PIN;           // リセットピン番号
+  byte i2cAddr;             // I2Cアドレス
   byte mode;                // 0:FM, 1:AM, 2:LSB, 3:USB
+  byte powerFunc;           // setRadioで電源を入れた機能 0:FM, 1:AM, 2:SSBパッチ(AM_ON_PATCH時はAMを含む), 0xFF:未設定
+  byte agcCmd[3];           // 送信済みのAGC_OVERRIDE [0]=0:未送信
+  word patchPos;            // 次に送るパッチのレコード番号
+  word patchSize;           // パッチのレコード数
+  byte patchProgress;       // パッチの進捗(%) PATCH_ERROR:エラーで中止
+  unsigned long patchTime;  // 最後のレコードを送った時刻(us)
+  uint32_t patchCrc;        // 読んだパッチのCRC32(途中経過)
+  uint32_t patchCrcRef;     // パッチのCRC32の期待値 0:確認しない
+  byte patchNext[8];        // CTS待ちの間に読んだ次のレコード
+  bool patchAhead;          // true:patchNextにpatchPosのレコードを読んである
+  #ifdef FLASHROMPATCH
+  word patchArg;            // 次に読むpatchArgsの位置
+  byte patchCount;          // PATCH_ARGSからのレコード数の残り
+  word patchIndex;          // 次に読むpatchDataの位置(圧縮後)
+  byte patchZero;           // 展開中の0の残り
+  #else
+  word patchAddr;           // パッチデータの外部EEPROMアドレス
+  #endif
   tRadio *rx;               //
   byte volume;              // 0:min - 63:max
   bool mute;                // true:mute
   char radioLabel[LABEL_SIZE][12];        //
   word intervalTime;        //
   bool seek;                //
+  bool tunePending;         // true:addFreqの周波数をまだチューンしていない
+  word tuneTime;            // 前回のチューン時刻(ms)
+  word tuneCheck;           // STCを確認した時刻(ms)
+  bool tuneWait;            // true:チューン完了を未通知
+  unsigned long tuneStartTime;  // チューン開始時刻(us)
+  unsigned long tuneLatency;    // 直前のチューンの所要時間(us)
+  word accelTime;           // 前回のクリック時刻(ms)
+  byte accelLevel;          // 加速段 0:1x, 1:10x, 2:100x
+  byte accelCount;          // 速いクリックの連続数
+  char accelDir;            // 前回の回転方向 1, -1
+  byte accelMax[4];         // モード毎の加速の上限
+  tAntCap antCapTable[ANTCAP_TABLE_SIZE];  // ANTCAP学習テーブル(周波数順)
+  byte antCapCount;         // 学習点の数
+  bool antCapAuto;          // true:直前のチューンはANTCAP自動選択
+  unsigned long ctsWaitTime;  // 直前のコマンドのCTS待ち時間(us)
+  unsigned long resWaitTime;  // 応答付きコマンドの最初の読込みまでの待ち時間(us 学習値)
+  byte lastError;           // 最後のエラー
+  byte intStatus;           // 未処理の割り込み要因
+  #ifdef INT_PIN
+  static volatile bool intFlag;  // true:INTピンの割り込みあり
+  static void intHandler();      // INTピンの割り込み処理
+  void setupInt();               // POWER_UP後の割り込み設定
+  word rsqProperty();            // モード毎のRSQ割り込みプロパティ番号
+  #endif
+  enum {Q_IDLE, Q_CTS, Q_COMP};
+  tCommand cmdQueue[CMDQUEUE_SIZE];  // 非同期コマンドキュー
+  byte queueHead;           // キューの先頭
+  byte queueCount;          // キューの登録数
+  byte queueState;          // Q_IDLE:送信待ち, Q_CTS:CTS待ち, Q_COMP:tCOMP待ち
+  unsigned long queueTime;  // 送信時刻(us)
+  bool async;               // true:commandOutをキューに登録する
+  tProperty propertyCache[PROPERTY_CACHE_SIZE]; // プロパティのシャドウ
+  byte propertyCount;       // シャドウの登録数(無効を含む)
+
+  #ifdef TRACE
+  tTrace traceBuf[TRACE_SIZE];  // トレースのリングバッファ
+  byte traceHead;           // 次の記録位置
+  byte traceCount;          // 記録数
+  void trace(const byte *cmd, byte cmdSize, byte status, byte resSize, unsigned long startTime);
+  #endif
 
+  #ifdef STATS
+  tStats statsBuf[STATS_SIZE];  // オペコード毎の統計
+  byte statsCount;          // 統計の登録数
+  unsigned long statWrite, statRead;          // 書込み・読込みバイト数の累計
+  unsigned long statMarkWrite, statMarkRead;  // 計測開始時のバイト数
+  unsigned long statTime;   // 非同期コマンドの計測開始時刻(us)
+  void statMark();
+  void countStats(byte opcode, unsigned long time);
+  #endif
+
+  byte sendCommand(const byte *cmd, byte size, byte *response = nullptr, byte resSize = 0);  // コマンドを送信しCTSを待ち、応答を読む
+  byte busWrite(byte addr, const byte *buf, byte size);  // I2C書込み(再送あり)
+  byte busRead(byte addr, byte *buf, byte size);         // I2C読込み(再送あり)
+  byte waitCts(byte opcode, byte *response = nullptr, byte resSize = 0);  // CTSの待機と応答の読込み
+  byte tuneStatus(byte arg, tTuneStatus &status);  // TUNE_STATUS arg bit1:CANCEL, bit0:INTACK
+  void tuneService(bool queued);  // 保留中のチューンの出力
+  byte checkStc();            // STCINTの確認
+  byte readIntStatus();       // GET_INT_STATUSで割り込み要因を読む
+  void ssbLabel(word freq);   // SSBの周波数表示
+  bool patchStart(word startAddr);  // パッチの送信位置の初期化
+  byte patchSend(byte records);     // パッチをrecords個送る(最後の適用待ちなし)
+  byte patchRead(byte *buf, byte records, word pos, bool seek);  // パッチをposから最大4レコード読んでCRC32を計算する
+  bool patchRecord(const byte *record, byte *next);  // パッチの1レコード送信 next:CTS待ちの間に次のレコードを読む
+  #ifdef FLASHROMPATCH
+  byte patchByte();           // 圧縮したpatchDataから1バイト展開
+  #endif
+  byte patchError();          // パッチのエラー中止
+  #ifndef FLASHROMPATCH
+  word patchHeader(word addr, byte *header);  // 外部EEPROMのヘッダの読込みと確認
+  #endif
+  void learnAntCap(word freq, word antCap);  // ANTCAPの学習
+  tProperty *findProperty(word property);           // シャドウの検索
+  void storeProperty(word property, word data);     // シャドウへの登録
+  void dropProperty(word property);                 // シャドウの無効化
+  void storePropertyTime(word property, unsigned long time);  // 完了時間の登録
+  void clearProperty();                             // シャドウの破棄
 };
 
@@ -0,0 +1,202 @@
+#pragma once
+/*
+  I2Cトランスポート
+  TinySI4732はSI4732_BUSで指定したクラスの静的関数でI2Cを操作する。仮想関数は使わない。
+    WireBus             ハードウェアWire（既定）
+    tWireBus<Wire1, SDA1, SCL1>  2番目のTwoWire（バスクリア用にピンを指定）
+    tSoftBus<sda, scl>  ソフトウェアI2C（ビットバング）
+    MockBus             ホスト(Linux)用のモック。関数の実体はホスト側で用意する
+
+  各クラスの静的関数
+    void begin(unsigned long clock)                 バスの初期化
+    byte write(byte addr, const byte *buf, byte size) 書込み 戻り値 0:正常, 2:アドレスNACK, 3:データNACK
+    byte read(byte addr, byte *buf, byte size)      読込み 戻り値:読込んだバイト数
+    void clear()                                    バスクリア SCLを最大9クロック出してSDAを解放させ、STOPを出す
+
+  タイムアウトとリトライ
+    1トランザクションはI2C_TIMEOUTで打ち切る(WireはWIRE_HAS_TIMEOUT対応コアのみ)。
+    tSoftBusはSCLが離されないまま期限を過ぎたら書込みはNACK、読込みは途中までのバイト数を返す。
+    TinySI4732は失敗時にI2C_RETRY回まで、100us, 200us, 400usのバックオフで再送し、
+    2回目以降の再送前にはバスクリアを行う。1トランザクションの最悪停止時間は
+      (I2C_RETRY + 1) * I2C_TIMEOUT + 700us + バスクリア2回(約0.2ms) ≒ 21ms
+    コマンドの最悪停止時間は 書込み21ms + CTS待ち上限(10ms, POWER_UPは500ms) + 読込み21ms * 2 ≒ 73ms
+*/
+#include <Arduino.h>
+#ifndef I2C_TIMEOUT
+#define I2C_TIMEOUT 5000  // 1トランザクションのタイムアウト(us)
+#endif
+#ifndef I2C_RETRY
+#define I2C_RETRY   3     // 再送回数
+#endif
+#ifdef ARDUINO
+#include <Wire.h>
+
+template <TwoWire &W, byte SDA_PIN = SDA, byte SCL_PIN = SCL>
+struct tWireBus{
+  static void begin(unsigned long clock){
+    busClock = clock;
+    W.begin();
+    W.setClock(clock);
+#ifdef WIRE_HAS_TIMEOUT
+    W.setWireTimeout(I2C_TIMEOUT, true);  // タイムアウト時はTWIをリセット
+#endif
+  }
+  static byte write(byte addr, const byte *buf, byte size){
+    W.beginTransmission(addr);
+    W.write(buf, size);
+    return W.endTransmission();
+  }
+  static byte read(byte addr, byte *buf, byte size){
+    byte n = W.requestFrom(addr, size);
+    for(byte i = 0; i < n; ++i)
+      buf[i] = W.read();
+    return n;
+  }
+  static void clear(){
+    W.end();
+    release(SDA_PIN);
+    release(SCL_PIN);
+    for(byte i = 0; i < 9 && digitalRead(SDA_PIN) == LOW; ++i){
+      pull(SCL_PIN);
+      delayMicroseconds(5);
+      release(SCL_PIN);
+      delayMicroseconds(5);
+    }
+    pull(SDA_PIN);  // STOP
+    delayMicroseconds(5);
+    release(SDA_PIN);
+    delayMicroseconds(5);
+    begin(busClock);
+  }
+
+  private:
+  static unsigned long busClock;
+  static void release(byte pin){ pinMode(pin, INPUT_PULLUP); }
+  static void pull(byte pin){ digitalWrite(pin, LOW); pinMode(pin, OUTPUT); }
+};
+template <TwoWire &W, byte SDA_PIN, byte SCL_PIN> unsigned long tWireBus<W, SDA_PIN, SCL_PIN>::busClock = 100000;
+typedef tWireBus<Wire> WireBus;
+
+template <byte SDA_PIN, byte SCL_PIN>
+struct tSoftBus{  // SDA, SCLは外部プルアップが必要
+  static void begin(unsigned long clock){
+    halfTime = 500000UL / clock;
+    if(halfTime == 0) halfTime = 1;
+    release(SDA_PIN);
+    release(SCL_PIN);
+  }
+  static byte write(byte addr, const byte *buf, byte size){
+    byte err = 0;
+    start();
+    if(!writeByte(addr << 1))
+      err = 2;  // アドレスNACK
+    for(byte i = 0; !err && i < size; ++i)
+      if(!writeByte(buf[i]))
+        err = 3;  // データNACK
+    stop();
+    return err;
+  }
+  static byte read(byte addr, byte *buf, byte size){
+    byte n = 0;
+    start();
+    if(writeByte((addr << 1) | 1))
+      for( ; n < size; ++n){
+        byte data = readByte(n + 1 < size);  // 最終バイトはNACK
+        if(stuck) break;  // タイムアウトしたバイトは数えない
+        buf[n] = data;
+      }
+    stop();
+    return n;
+  }
+  static void clear(){
+    startTime = micros();
+    stuck = false;
+    release(SDA_PIN);
+    for(byte i = 0; i < 9 && digitalRead(SDA_PIN) == LOW; ++i){
+      delayMicroseconds(halfTime);
+      sclHigh();
+      pull(SCL_PIN);
+    }
+    pull(SCL_PIN);
+    stop();
+  }
+
+  private:
+  static word halfTime;  // 半周期(us)
+  static unsigned long startTime;  // トランザクションの開始時刻(us)
+  static bool stuck;  // SCLが離されないままI2C_TIMEOUTを過ぎた
+
+  static void release(byte pin){ pinMode(pin, INPUT); }  // オープンドレインのHIGH
+  static void pull(byte pin){ digitalWrite(pin, LOW); pinMode(pin, OUTPUT); }
+  static bool sclHigh(){  // 戻り値 false:タイムアウト
+    release(SCL_PIN);
+    while(digitalRead(SCL_PIN) == LOW){  // クロックストレッチ
+      if(micros() - startTime >= I2C_TIMEOUT){
+        stuck = true;
+        return false;
+      }
+      delayMicroseconds(halfTime);
+    }
+    delayMicroseconds(halfTime);
+    return true;
+  }
+  static void start(){
+    startTime = micros();
+    stuck = false;
+    release(SDA_PIN);
+    sclHigh();
+    pull(SDA_PIN);
+    delayMicroseconds(halfTime);
+    pull(SCL_PIN);
+  }
+  static void stop(){
+    pull(SDA_PIN);
+    delayMicroseconds(halfTime);
+    sclHigh();
+    release(SDA_PIN);
+    delayMicroseconds(halfTime);
+  }
+  static bool writeByte(byte data){  // 戻り値 true:ACK
+    for(byte mask = 0x80; mask; mask >>= 1){
+      if(data & mask) release(SDA_PIN); else pull(SDA_PIN);
+      delayMicroseconds(halfTime);
+      sclHigh();
+      pull(SCL_PIN);
+    }
+    release(SDA_PIN);
+    delayMicroseconds(halfTime);
+    bool ack = sclHigh() && digitalRead(SDA_PIN) == LOW && !stuck;
+    pull(SCL_PIN);
+    return ack;
+  }
+  static byte readByte(bool ack){
+    byte data = 0;
+    release(SDA_PIN);
+    for(byte i = 0; i < 8; ++i){
+      delayMicroseconds(halfTime);
+      sclHigh();
+      data = (data << 1) | (digitalRead(SDA_PIN) == HIGH);
+      pull(SCL_PIN);
+    }
+    if(ack) pull(SDA_PIN); else release(SDA_PIN);
+    delayMicroseconds(halfTime);
+    sclHigh();
+    pull(SCL_PIN);
+    release(SDA_PIN);
+    return data;
+  }
+};
+template <byte SDA_PIN, byte SCL_PIN> word tSoftBus<SDA_PIN, SCL_PIN>::halfTime = 1;
+template <byte SDA_PIN, byte SCL_PIN> unsigned long tSoftBus<SDA_PIN, SCL_PIN>::startTime;
+template <byte SDA_PIN, byte SCL_PIN> bool tSoftBus<SDA_PIN, SCL_PIN>::stuck;
+
+#else
+
+struct MockBus{  // ホスト用。extras/hostのモックまたはシミュレータで実装する
+  static void begin(unsigned long clock);
+  static byte write(byte addr, const byte *buf, byte size);
+  static byte read(byte addr, byte *buf, byte size);
+  static void clear();
+};
+
+#endif